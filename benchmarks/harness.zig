@@ -0,0 +1,443 @@
+// Native benchmark harness with regression tracking
+//
+// The shell scripts in benchmarks/ time whole processes with hyperfine, which
+// is fine for cross-language comparisons but cannot see sub-millisecond
+// runtime regressions (process startup noise swamps them). This harness runs
+// the same scenario families (fib, dict, string, json, regex, tokenizer)
+// in-process against the runtime modules, with warmup, nanosecond timers and
+// rusage capture, and compares medians against a stored baseline so CI can
+// fail on a real slowdown.
+//
+// Usage (from repo root):
+//   zig build bench-native                          run all scenarios
+//   zig build bench-native -- --filter json         run matching scenarios
+//   zig build bench-native -- --save-baseline       record benchmarks/baseline.json
+//   zig build bench-native -- --baseline benchmarks/baseline.json --threshold 5
+//
+// Exits non-zero when any scenario's median exceeds baseline * (1 + threshold).
+
+const std = @import("std");
+const runtime = @import("runtime");
+const allocator_helper = @import("allocator_helper");
+const regex = @import("regex");
+const tokenizer = @import("tokenizer");
+
+const DEFAULT_WARMUP = 3;
+const DEFAULT_ITERATIONS = 30;
+const DEFAULT_THRESHOLD_PCT = 5.0;
+const DEFAULT_BASELINE_PATH = "benchmarks/baseline.json";
+
+// Data files, relative to repo root (where `zig build` and `make` run)
+const SAMPLE_JSON_PATH = "packages/runtime/benchmarks/sample.json";
+const TOKENIZER_VOCAB_PATH = "packages/tokenizer/hf_trained.json";
+
+const SAMPLE_TEXT =
+    "The quick brown fox jumps over the lazy dog. " ++
+    "Pack my box with five dozen liquor jugs. " ++
+    "How vexingly quick daft zebras jump! " ++
+    "Contact alice@example.com or bob@test.org for details v2 rev17. " ++
+    "Sphinx of black quartz, judge my vow.";
+
+/// Shared state built once per scenario before the timed loop
+const Context = struct {
+    base_allocator: std.mem.Allocator,
+    json_str: ?*runtime.PyObject = null,
+    json_obj: ?*runtime.PyObject = null,
+    re: ?regex.Regex = null,
+    tok: ?tokenizer.Tokenizer = null,
+
+    fn deinit(self: *Context) void {
+        if (self.tok) |*t| t.deinit();
+        self.tok = null;
+        if (self.re) |*r| r.deinit();
+        self.re = null;
+        if (self.json_obj) |obj| runtime.decref(obj, self.base_allocator);
+        self.json_obj = null;
+        if (self.json_str) |str| runtime.decref(str, self.base_allocator);
+        self.json_str = null;
+    }
+};
+
+const Scenario = struct {
+    name: []const u8,
+    setup: ?*const fn (*Context) anyerror!void = null,
+    run: *const fn (*Context, std.mem.Allocator) anyerror!void,
+};
+
+const scenarios = [_]Scenario{
+    .{ .name = "fib", .run = runFib },
+    .{ .name = "dict", .run = runDict },
+    .{ .name = "string", .run = runString },
+    .{ .name = "json_parse", .setup = setupJsonParse, .run = runJsonParse },
+    .{ .name = "json_stringify", .setup = setupJsonStringify, .run = runJsonStringify },
+    .{ .name = "regex", .setup = setupRegex, .run = runRegex },
+    .{ .name = "tokenizer", .setup = setupTokenizer, .run = runTokenizer },
+};
+
+// --- Scenarios ---------------------------------------------------------
+
+fn fib(n: u32) u64 {
+    if (n < 2) return n;
+    return fib(n - 1) + fib(n - 2);
+}
+
+/// Recursive call + integer arithmetic baseline
+fn runFib(ctx: *Context, allocator: std.mem.Allocator) !void {
+    _ = ctx;
+    _ = allocator;
+    std.mem.doNotOptimizeAway(fib(25));
+}
+
+/// PyDict insert, lookup and membership over 1000 string keys
+fn runDict(ctx: *Context, allocator: std.mem.Allocator) !void {
+    _ = ctx;
+    const dict = try runtime.PyDict.create(allocator);
+
+    var key_buf: [32]u8 = undefined;
+    var i: usize = 0;
+    while (i < 1000) : (i += 1) {
+        const key = try std.fmt.bufPrint(&key_buf, "key_{d}", .{i});
+        const value = try runtime.PyInt.create(allocator, @intCast(i));
+        try runtime.PyDict.set(dict, key, value);
+    }
+
+    var hits: usize = 0;
+    i = 0;
+    while (i < 1000) : (i += 1) {
+        const key = try std.fmt.bufPrint(&key_buf, "key_{d}", .{i});
+        if (runtime.PyDict.get(dict, key) != null) hits += 1;
+        if (runtime.PyDict.contains(dict, key)) hits += 1;
+    }
+    std.mem.doNotOptimizeAway(hits);
+    std.mem.doNotOptimizeAway(runtime.PyDict.len(dict));
+}
+
+/// PyString upper/split/join/replace pipeline (arena frees the intermediates)
+fn runString(ctx: *Context, allocator: std.mem.Allocator) !void {
+    _ = ctx;
+    const text = try runtime.PyString.create(allocator, SAMPLE_TEXT);
+    const upper = try runtime.PyString.upper(allocator, text);
+    const sep = try runtime.PyString.create(allocator, " ");
+    const parts = try runtime.PyString.split(allocator, upper, sep);
+    const joined = try runtime.PyString.join(allocator, sep, parts);
+    const old = try runtime.PyString.create(allocator, "QUICK");
+    const new = try runtime.PyString.create(allocator, "SLOW");
+    const replaced = try runtime.PyString.replace(allocator, joined, old, new);
+    std.mem.doNotOptimizeAway(replaced);
+}
+
+fn setupJsonParse(ctx: *Context) !void {
+    const file = try std.fs.cwd().openFile(SAMPLE_JSON_PATH, .{});
+    defer file.close();
+    const data = try file.readToEndAlloc(ctx.base_allocator, 1024 * 1024);
+    defer ctx.base_allocator.free(data);
+    ctx.json_str = try runtime.PyString.create(ctx.base_allocator, data);
+}
+
+/// Parse the 62KB sample document (same input as bench_metal0_json_parse_fast)
+fn runJsonParse(ctx: *Context, allocator: std.mem.Allocator) !void {
+    const parsed = try runtime.json.loads(ctx.json_str.?, allocator);
+    std.mem.doNotOptimizeAway(parsed);
+}
+
+fn setupJsonStringify(ctx: *Context) !void {
+    try setupJsonParse(ctx);
+    ctx.json_obj = try runtime.json.loads(ctx.json_str.?, ctx.base_allocator);
+}
+
+/// Serialize the pre-parsed sample document
+fn runJsonStringify(ctx: *Context, allocator: std.mem.Allocator) !void {
+    const out = try runtime.json.dumpsDirect(ctx.json_obj.?, allocator);
+    std.mem.doNotOptimizeAway(out.ptr);
+}
+
+fn setupRegex(ctx: *Context) !void {
+    ctx.re = try regex.Regex.compile(ctx.base_allocator, "[a-z]+@[a-z]+\\.[a-z]+|[a-z]+[0-9]+");
+}
+
+/// Scan the sample text for emails and versioned tokens (zero-copy spans)
+fn runRegex(ctx: *Context, allocator: std.mem.Allocator) !void {
+    _ = allocator;
+    var spans = try ctx.re.?.findAllSpans(SAMPLE_TEXT);
+    defer spans.deinit(ctx.base_allocator);
+    std.mem.doNotOptimizeAway(spans.items.len);
+}
+
+fn setupTokenizer(ctx: *Context) !void {
+    const file = try std.fs.cwd().openFile(TOKENIZER_VOCAB_PATH, .{});
+    defer file.close();
+    const data = try file.readToEndAlloc(ctx.base_allocator, 16 * 1024 * 1024);
+    defer ctx.base_allocator.free(data);
+    ctx.tok = try tokenizer.Tokenizer.initFromData(data, ctx.base_allocator);
+}
+
+/// BPE-encode the sample text with the trained vocabulary
+fn runTokenizer(ctx: *Context, allocator: std.mem.Allocator) !void {
+    _ = allocator;
+    const tokens = try ctx.tok.?.encode(SAMPLE_TEXT);
+    defer ctx.base_allocator.free(tokens);
+    std.mem.doNotOptimizeAway(tokens.len);
+}
+
+// --- Measurement -------------------------------------------------------
+
+const Result = struct {
+    name: []const u8,
+    iterations: u64,
+    min_ns: u64,
+    max_ns: u64,
+    mean_ns: u64,
+    median_ns: u64,
+    stddev_ns: u64,
+    user_us: u64,
+    sys_us: u64,
+};
+
+fn timevalToMicros(tv: anytype) u64 {
+    const sec: u64 = @intCast(@max(tv.sec, 0));
+    const usec: u64 = @intCast(@max(tv.usec, 0));
+    return sec * 1_000_000 + usec;
+}
+
+fn measure(ctx: *Context, scenario: Scenario, warmup: u64, iterations: u64, samples: []u64) !Result {
+    if (scenario.setup) |setup| try setup(ctx);
+
+    // One arena reused across iterations, reset between them (matches the
+    // existing json bench: ~2x faster than a fresh arena per iteration and
+    // keeps allocator churn out of the measurement)
+    var arena = std.heap.ArenaAllocator.init(ctx.base_allocator);
+    defer arena.deinit();
+
+    var i: u64 = 0;
+    while (i < warmup) : (i += 1) {
+        try scenario.run(ctx, arena.allocator());
+        _ = arena.reset(.retain_capacity);
+    }
+
+    const ru_before = std.posix.getrusage(std.posix.rusage.SELF);
+    var timer = try std.time.Timer.start();
+
+    i = 0;
+    while (i < iterations) : (i += 1) {
+        timer.reset();
+        try scenario.run(ctx, arena.allocator());
+        samples[i] = timer.read();
+        _ = arena.reset(.retain_capacity);
+    }
+
+    const ru_after = std.posix.getrusage(std.posix.rusage.SELF);
+
+    const used = samples[0..iterations];
+    std.mem.sort(u64, used, {}, std.sort.asc(u64));
+
+    var total: u128 = 0;
+    for (used) |s| total += s;
+    const mean: u64 = @intCast(total / iterations);
+
+    var var_sum: u128 = 0;
+    for (used) |s| {
+        const d: i128 = @as(i128, s) - mean;
+        var_sum += @intCast(d * d);
+    }
+    const stddev = std.math.sqrt(@as(u64, @intCast(var_sum / iterations)));
+
+    const median = if (iterations % 2 == 0)
+        (used[iterations / 2 - 1] + used[iterations / 2]) / 2
+    else
+        used[iterations / 2];
+
+    return .{
+        .name = scenario.name,
+        .iterations = iterations,
+        .min_ns = used[0],
+        .max_ns = used[iterations - 1],
+        .mean_ns = mean,
+        .median_ns = median,
+        .stddev_ns = stddev,
+        .user_us = timevalToMicros(ru_after.utime) - timevalToMicros(ru_before.utime),
+        .sys_us = timevalToMicros(ru_after.stime) - timevalToMicros(ru_before.stime),
+    };
+}
+
+// --- Baseline ----------------------------------------------------------
+
+/// Baseline file maps scenario name -> median_ns from a trusted run
+fn loadBaselineMedian(parsed: std.json.Value, name: []const u8) ?u64 {
+    const obj = switch (parsed) {
+        .object => |o| o,
+        else => return null,
+    };
+    const entry = obj.get(name) orelse return null;
+    const median = switch (entry) {
+        .object => |o| o.get("median_ns") orelse return null,
+        else => return null,
+    };
+    return switch (median) {
+        .integer => |v| if (v >= 0) @intCast(v) else null,
+        else => null,
+    };
+}
+
+fn writeResultsJson(path: []const u8, results: []const Result, max_rss_kb: u64) !void {
+    var buf: [16384]u8 = undefined;
+    var w: std.Io.Writer = .fixed(&buf);
+
+    try w.print("{{\n", .{});
+    for (results) |r| {
+        // "max_rss_kb" always follows, so every entry takes a trailing comma
+        try w.print(
+            "  \"{s}\": {{ \"iterations\": {d}, \"min_ns\": {d}, \"max_ns\": {d}, " ++
+                "\"mean_ns\": {d}, \"median_ns\": {d}, \"stddev_ns\": {d}, " ++
+                "\"user_us\": {d}, \"sys_us\": {d} }},\n",
+            .{
+                r.name,    r.iterations, r.min_ns,    r.max_ns,
+                r.mean_ns, r.median_ns,  r.stddev_ns, r.user_us,
+                r.sys_us,
+            },
+        );
+    }
+    try w.print("  \"max_rss_kb\": {d}\n}}\n", .{max_rss_kb});
+
+    const file = try std.fs.cwd().createFile(path, .{});
+    defer file.close();
+    try file.writeAll(w.buffered());
+}
+
+// --- Driver ------------------------------------------------------------
+
+const Options = struct {
+    warmup: u64 = DEFAULT_WARMUP,
+    iterations: u64 = DEFAULT_ITERATIONS,
+    threshold_pct: f64 = DEFAULT_THRESHOLD_PCT,
+    filter: ?[]const u8 = null,
+    json_path: ?[]const u8 = null,
+    baseline_path: ?[]const u8 = null,
+    save_baseline: bool = false,
+};
+
+fn parseArgs(args: [][:0]u8) !Options {
+    var opts = Options{};
+    var i: usize = 1;
+    while (i < args.len) : (i += 1) {
+        const arg = args[i];
+        if (std.mem.eql(u8, arg, "--warmup")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.warmup = try std.fmt.parseInt(u64, args[i], 10);
+        } else if (std.mem.eql(u8, arg, "--iterations")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.iterations = try std.fmt.parseInt(u64, args[i], 10);
+        } else if (std.mem.eql(u8, arg, "--threshold")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.threshold_pct = try std.fmt.parseFloat(f64, args[i]);
+        } else if (std.mem.eql(u8, arg, "--filter")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.filter = args[i];
+        } else if (std.mem.eql(u8, arg, "--json")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.json_path = args[i];
+        } else if (std.mem.eql(u8, arg, "--baseline")) {
+            i += 1;
+            if (i >= args.len) return error.MissingArgValue;
+            opts.baseline_path = args[i];
+        } else if (std.mem.eql(u8, arg, "--save-baseline")) {
+            opts.save_baseline = true;
+        } else {
+            std.debug.print("unknown option: {s}\n", .{arg});
+            return error.UnknownOption;
+        }
+    }
+    if (opts.iterations == 0) return error.MissingArgValue;
+    return opts;
+}
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{}){};
+    defer _ = gpa.deinit();
+    const base_allocator = allocator_helper.getAllocator(&gpa);
+
+    const args = try std.process.argsAlloc(base_allocator);
+    defer std.process.argsFree(base_allocator, args);
+    const opts = try parseArgs(args);
+
+    const baseline_path = opts.baseline_path orelse DEFAULT_BASELINE_PATH;
+
+    // Load baseline if present (absence is not an error: first run records it)
+    var baseline_parsed: ?std.json.Parsed(std.json.Value) = null;
+    defer if (baseline_parsed) |*p| p.deinit();
+    if (!opts.save_baseline) blk: {
+        const file = std.fs.cwd().openFile(baseline_path, .{}) catch break :blk;
+        defer file.close();
+        const data = file.readToEndAlloc(base_allocator, 1024 * 1024) catch break :blk;
+        defer base_allocator.free(data);
+        baseline_parsed = std.json.parseFromSlice(std.json.Value, base_allocator, data, .{}) catch break :blk;
+    }
+
+    const samples = try base_allocator.alloc(u64, opts.iterations);
+    defer base_allocator.free(samples);
+
+    var results: [scenarios.len]Result = undefined;
+    var result_count: usize = 0;
+    var regressions: usize = 0;
+
+    std.debug.print("{s:<16} {s:>12} {s:>12} {s:>12} {s:>12}  {s}\n", .{
+        "scenario", "median", "mean", "min", "stddev", "vs baseline",
+    });
+
+    for (scenarios) |scenario| {
+        if (opts.filter) |f| {
+            if (std.mem.indexOf(u8, scenario.name, f) == null) continue;
+        }
+
+        var ctx = Context{ .base_allocator = base_allocator };
+        defer ctx.deinit();
+
+        const result = measure(&ctx, scenario, opts.warmup, opts.iterations, samples) catch |err| {
+            std.debug.print("{s:<16} skipped ({s})\n", .{ scenario.name, @errorName(err) });
+            continue;
+        };
+        results[result_count] = result;
+        result_count += 1;
+
+        var delta_buf: [64]u8 = undefined;
+        var delta: []const u8 = "(no baseline)";
+        if (baseline_parsed) |p| {
+            if (loadBaselineMedian(p.value, result.name)) |old_median| {
+                const pct = (@as(f64, @floatFromInt(result.median_ns)) /
+                    @as(f64, @floatFromInt(@max(old_median, 1))) - 1.0) * 100.0;
+                const regressed = pct > opts.threshold_pct;
+                if (regressed) regressions += 1;
+                delta = try std.fmt.bufPrint(&delta_buf, "{s}{d:.1}%{s}", .{
+                    if (pct >= 0) "+" else "", pct,
+                    if (regressed) " REGRESSION" else "",
+                });
+            }
+        }
+
+        std.debug.print("{s:<16} {d:>10}ns {d:>10}ns {d:>10}ns {d:>10}ns  {s}\n", .{
+            result.name, result.median_ns, result.mean_ns,
+            result.min_ns, result.stddev_ns, delta,
+        });
+    }
+
+    const ru = std.posix.getrusage(std.posix.rusage.SELF);
+    const max_rss_kb: u64 = @intCast(@max(ru.maxrss, 0));
+    std.debug.print("max rss: {d} KB\n", .{max_rss_kb});
+
+    if (opts.json_path) |path| {
+        try writeResultsJson(path, results[0..result_count], max_rss_kb);
+    }
+    if (opts.save_baseline) {
+        try writeResultsJson(baseline_path, results[0..result_count], max_rss_kb);
+        std.debug.print("baseline saved to {s}\n", .{baseline_path});
+    }
+
+    if (regressions > 0) {
+        std.debug.print("{d} scenario(s) regressed beyond {d:.1}%\n", .{ regressions, opts.threshold_pct });
+        std.process.exit(1);
+    }
+}
@@ -40,11 +40,33 @@ result = np.dot(a, b)
 print(np.sum(result))
 EOF
 
+# Fused elementwise expression (SAME code for metal0, Python, PyPy)
+# a*b + c compiles to a single fused SIMD loop in metal0
+cat > fused.py <<'EOF'
+import numpy
+
+n = 1000000
+a = numpy.ones(n)
+b = numpy.ones(n)
+c = numpy.ones(n)
+
+total = 0.0
+i = 0
+while i < 50:
+    r = a * b + c
+    total = total + numpy.sum(r)
+    i = i + 1
+print(total)
+EOF
+
+cp fused.py fused_numpy.py
+
 echo "Building..."
 build_metal0_compiler
 compile_metal0 matmul.py matmul_metal0
+compile_metal0 fused.py fused_metal0
 
-print_header "Running Benchmarks"
+print_header "Running Benchmarks (matmul)"
 BENCH_CMD=(hyperfine --warmup 1 --runs 5 --export-markdown results.md)
 
 add_metal0 BENCH_CMD matmul_metal0
@@ -53,8 +75,17 @@ add_pypy BENCH_CMD matmul_numpy.py
 
 "${BENCH_CMD[@]}"
 
+print_header "Running Benchmarks (fused elementwise)"
+FUSED_CMD=(hyperfine --warmup 1 --runs 5 --export-markdown results_fused.md)
+
+add_metal0 FUSED_CMD fused_metal0
+add_python FUSED_CMD fused_numpy.py numpy
+add_pypy FUSED_CMD fused_numpy.py
+
+"${FUSED_CMD[@]}"
+
 # Cleanup
-rm -f matmul_metal0
+rm -f matmul_metal0 fused_metal0
 
 echo ""
-echo "Results saved to: results.md"
+echo "Results saved to: results.md and results_fused.md"
@@ -34,8 +34,21 @@ def benchmark():
         total_len = total_len + len(a)
         k = k + 1
 
+    # 3. Substring search (in / find)
+    line = "2024-01-01 12:00:00 INFO request served in 12ms path=/api/users"
+    hits = 0
+    found_at = 0
+    m = 0
+    while m < n:
+        if "path=" in line:
+            hits = hits + 1
+        found_at = found_at + line.find("INFO")
+        m = m + 1
+
     print(matches)
     print(total_len)
+    print(hits)
+    print(found_at)
 
 benchmark()
 EOF
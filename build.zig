@@ -71,6 +71,11 @@ pub fn build(b: *std.Build) void {
         .root_source_file = b.path("packages/bigint/src/bigint.zig"),
     });
 
+    // BPE tokenizer (self-contained package, used by the benchmark harness)
+    const tokenizer_mod = b.addModule("tokenizer", .{
+        .root_source_file = b.path("packages/tokenizer/src/tokenizer.zig"),
+    });
+
     // Module dependencies
     runtime.addImport("hashmap_helper", hashmap_helper);
     runtime.addImport("json_simd", json_simd);
@@ -269,6 +274,31 @@ pub fn build(b: *std.Build) void {
     const bench_json_stringify_step = b.step("bench-json-stringify", "Build and run JSON stringify benchmark");
     bench_json_stringify_step.dependOn(&run_bench_json_stringify.step);
 
+    // Native benchmark harness with regression tracking
+    const bench_harness = b.addExecutable(.{
+        .name = "metal0-bench",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("benchmarks/harness.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        }),
+    });
+    bench_harness.root_module.addImport("runtime", runtime);
+    bench_harness.root_module.addImport("allocator_helper", allocator_helper);
+    bench_harness.root_module.addImport("regex", regex_mod);
+    bench_harness.root_module.addImport("tokenizer", tokenizer_mod);
+    bench_harness.linkLibC();
+
+    b.installArtifact(bench_harness);
+
+    const run_bench_harness = b.addRunArtifact(bench_harness);
+    run_bench_harness.setCwd(b.path("."));
+    if (b.args) |args| {
+        run_bench_harness.addArgs(args);
+    }
+    const bench_harness_step = b.step("bench-native", "Run the native benchmark harness");
+    bench_harness_step.dependOn(&run_bench_harness.step);
+
     // Token optimizer proxy - build from packages/token_optimizer/ directory
     // It has its own build.zig with zigimg dependency
     // Run: cd packages/token_optimizer && zig build
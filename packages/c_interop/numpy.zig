@@ -333,6 +333,33 @@ pub fn expand_dims(arr_obj: *PyObject, axis: usize, allocator: std.mem.Allocator
 // Element-wise Functions
 // ============================================================================
 
+/// Tuple type for fused() with *PyObject inputs unwrapped to *NumpyArray
+fn UnwrappedInputs(comptime T: type) type {
+    const fields = std.meta.fields(T);
+    comptime var types: [fields.len]type = undefined;
+    inline for (fields, 0..) |field, i| {
+        types[i] = if (field.type == *PyObject) *NumpyArray else f64;
+    }
+    return std.meta.Tuple(&types);
+}
+
+/// Fused elementwise expression over PyObject arrays and f64 scalars.
+/// The codegen layer compiles chained numpy arithmetic (a*b + c) into one
+/// call here, so the whole expression runs as a single SIMD loop with one
+/// output allocation instead of a temporary per operation. See
+/// NumpyArray.fusedElementwise for the kernel contract.
+pub fn fused(comptime kernel: anytype, inputs: anytype, allocator: std.mem.Allocator) !*PyObject {
+    var unwrapped: UnwrappedInputs(@TypeOf(inputs)) = undefined;
+    inline for (std.meta.fields(@TypeOf(inputs)), 0..) |field, i| {
+        unwrapped[i] = if (field.type == *PyObject)
+            try numpy_array_mod.extractArray(inputs[i])
+        else
+            @as(f64, inputs[i]);
+    }
+    const result = try NumpyArray.fusedElementwise(allocator, kernel, unwrapped);
+    return try numpy_array_mod.createPyObject(allocator, result);
+}
+
 /// Element-wise addition - np.add(a, b)
 pub fn add(a_obj: *PyObject, b_obj: *PyObject, allocator: std.mem.Allocator) !*PyObject {
     const a = try numpy_array_mod.extractArray(a_obj);
@@ -1,11 +1,19 @@
 /// Zlib Compression Library
 /// Python-compatible API for zlib module
+///
+/// Whole-buffer compress/decompress go through libdeflate (vendor/libdeflate),
+/// which is 2-3x faster than zlib's streaming codec. The zlib streaming API
+/// remains for compressobj/decompressobj and as a decompress fallback.
 const std = @import("std");
 
 const c = @cImport({
     @cInclude("zlib.h");
 });
 
+const ld = @cImport({
+    @cInclude("libdeflate.h");
+});
+
 // Compression levels (Python zlib compatible)
 pub const Z_NO_COMPRESSION = 0;
 pub const Z_BEST_SPEED = 1;
@@ -38,7 +46,35 @@ pub fn compress(data: []const u8, allocator: std.mem.Allocator) ![]u8 {
 }
 
 /// Compress data with specified level (-1 to 9)
+/// Fast path: libdeflate whole-buffer compress; zlib streaming fallback
 pub fn compressWithLevel(data: []const u8, level: c_int, allocator: std.mem.Allocator) ![]u8 {
+    const actual_level: c_int = if (level == Z_DEFAULT_COMPRESSION) 6 else level;
+    if (ld.libdeflate_alloc_compressor(actual_level)) |compressor| {
+        defer ld.libdeflate_free_compressor(compressor);
+
+        const bound = ld.libdeflate_zlib_compress_bound(compressor, data.len);
+        const output = try allocator.alloc(u8, bound);
+        errdefer allocator.free(output);
+
+        const compressed_size = ld.libdeflate_zlib_compress(
+            compressor,
+            data.ptr,
+            data.len,
+            output.ptr,
+            output.len,
+        );
+        if (compressed_size != 0) {
+            return allocator.realloc(output, compressed_size) catch output[0..compressed_size];
+        }
+        allocator.free(output);
+        // Bound-sized buffer should never run out of space; fall through
+        // to the streaming path just in case
+    }
+    return compressStreaming(data, level, allocator);
+}
+
+/// Streaming fallback via zlib's compress2
+fn compressStreaming(data: []const u8, level: c_int, allocator: std.mem.Allocator) ![]u8 {
     const bound = c.compressBound(@intCast(data.len));
     var compressed = try allocator.alloc(u8, bound);
     errdefer allocator.free(compressed);
@@ -82,7 +118,50 @@ pub fn decompress(data: []const u8, original_size: usize, allocator: std.mem.All
 }
 
 /// Decompress data with auto-growing buffer (unknown size)
+/// Fast path: libdeflate whole-buffer decompress; zlib streaming fallback
+/// for streams libdeflate rejects
 pub fn decompressAuto(data: []const u8, allocator: std.mem.Allocator) ![]u8 {
+    fast: {
+        const decompressor = ld.libdeflate_alloc_decompressor() orelse break :fast;
+        defer ld.libdeflate_free_decompressor(decompressor);
+
+        var buf_size: usize = @max(data.len * 5, 1024);
+        var output = try allocator.alloc(u8, buf_size);
+        errdefer allocator.free(output);
+
+        while (buf_size <= 256 * 1024 * 1024) {
+            var actual_out_size: usize = 0;
+            const result = ld.libdeflate_zlib_decompress(
+                decompressor,
+                data.ptr,
+                data.len,
+                output.ptr,
+                output.len,
+                &actual_out_size,
+            );
+
+            switch (result) {
+                ld.LIBDEFLATE_SUCCESS => {
+                    return allocator.realloc(output, actual_out_size) catch output[0..actual_out_size];
+                },
+                ld.LIBDEFLATE_INSUFFICIENT_SPACE => {
+                    buf_size *= 2;
+                    output = try allocator.realloc(output, buf_size);
+                },
+                else => {
+                    // Not a stream libdeflate accepts - try generic inflate
+                    allocator.free(output);
+                    break :fast;
+                },
+            }
+        }
+        return error.BufferTooLarge;
+    }
+    return decompressAutoStreaming(data, allocator);
+}
+
+/// Streaming fallback via zlib's uncompress with auto-growing buffer
+fn decompressAutoStreaming(data: []const u8, allocator: std.mem.Allocator) ![]u8 {
     // Start with estimate: uncompressed is usually ~5x compressed
     var buf_size: usize = data.len * 5;
     if (buf_size < 1024) buf_size = 1024;
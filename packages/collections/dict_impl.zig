@@ -5,6 +5,12 @@
 /// - PyObject dicts (with refcount)
 /// - Different hash functions (wyhash, tp_hash)
 /// - Zero runtime cost (comptime specialization)
+///
+/// Layout is CPython's compact dict: a dense insertion-ordered entries
+/// array plus a small open-addressed index of entry slots. Iteration walks
+/// the dense array (cache-friendly, insertion order); lookups probe the
+/// index. Dicts under 8 entries skip the index entirely and linear-scan
+/// the dense array - most dicts in request handling stay that small.
 
 const std = @import("std");
 
@@ -23,9 +29,25 @@ pub fn DictImpl(comptime Config: type) type {
     return struct {
         const Self = @This();
 
+        /// Up to this many live entries no index exists - lookups scan the
+        /// dense array directly (fits in one or two cache lines)
+        const SMALL_TABLE_MAX = 8;
+
+        /// Index slot markers (valid entry slots are >= 0)
+        const EMPTY: i32 = -1;
+        const DELETED: i32 = -2;
+
+        /// Dense, insertion-ordered entry storage. Deleted entries leave a
+        /// hole (used = false) so slots already published in the index stay
+        /// valid; holes are squeezed out on the next index rebuild.
         entries: []Entry,
+        entries_len: usize,
+        entries_cap: usize,
+        /// Open-addressed index into entries (power-of-two length).
+        /// Empty while the dict is small.
+        index: []i32,
+        /// Number of live (non-hole) entries
         size: usize,
-        capacity: usize,
         allocator: std.mem.Allocator,
 
         const Entry = struct {
@@ -33,97 +55,96 @@ pub fn DictImpl(comptime Config: type) type {
             value: Config.ValueType,
             hash: u64,
             used: bool,
-            deleted: bool, // Tombstone for open addressing
         };
 
         /// Initialize empty dict
         pub fn init(allocator: std.mem.Allocator) !Self {
-            const initial_capacity = 8;
-            const entries = try allocator.alloc(Entry, initial_capacity);
-
-            for (entries) |*entry| {
-                entry.* = .{
-                    .key = undefined,
-                    .value = undefined,
-                    .hash = 0,
-                    .used = false,
-                    .deleted = false,
-                };
-            }
-
+            const entries = try allocator.alloc(Entry, SMALL_TABLE_MAX);
             return Self{
                 .entries = entries,
+                .entries_len = 0,
+                .entries_cap = SMALL_TABLE_MAX,
+                .index = &.{},
                 .size = 0,
-                .capacity = initial_capacity,
                 .allocator = allocator,
             };
         }
 
-        /// Set key-value pair
-        pub fn set(self: *Self, key: Config.KeyType, value: Config.ValueType) !void {
-            // Check load factor (resize at 75%)
-            if (self.size * 4 >= self.capacity * 3) {
-                try self.resize();
-            }
-
-            const hash = Config.hashKey(key);
-            var idx = hash % self.capacity;
-            var probe_count: usize = 0;
-
-            // Linear probing with tombstones
-            while (probe_count < self.capacity) : (probe_count += 1) {
-                const entry = &self.entries[idx];
-
-                if (!entry.used) {
-                    // Empty slot - insert new
-                    entry.* = .{
-                        .key = Config.retainKey(key),
-                        .value = Config.retainValue(value),
-                        .hash = hash,
-                        .used = true,
-                        .deleted = false,
-                    };
-                    self.size += 1;
-                    return;
+        /// Find the dense slot of a key, or null
+        fn findEntry(self: *Self, key: Config.KeyType, hash: u64) ?usize {
+            if (self.index.len == 0) {
+                // Small-table fast path: linear scan, no index indirection
+                for (self.entries[0..self.entries_len], 0..) |*entry, slot| {
+                    if (entry.used and entry.hash == hash and Config.keysEqual(entry.key, key)) {
+                        return slot;
+                    }
                 }
+                return null;
+            }
 
-                if (entry.hash == hash and Config.keysEqual(entry.key, key)) {
-                    // Update existing
-                    Config.releaseValue(entry.value);
-                    entry.value = Config.retainValue(value);
-                    return;
+            const mask = self.index.len - 1;
+            var idx = hash & mask;
+            while (true) {
+                const slot = self.index[idx];
+                if (slot == EMPTY) return null;
+                if (slot >= 0) {
+                    const entry = &self.entries[@intCast(slot)];
+                    if (entry.used and entry.hash == hash and Config.keysEqual(entry.key, key)) {
+                        return @intCast(slot);
+                    }
                 }
-
-                // Continue probing
-                idx = (idx + 1) % self.capacity;
+                idx = (idx + 1) & mask;
             }
+        }
 
-            // Should never reach here (resize prevents this)
-            return error.TableFull;
+        /// Publish a dense slot in the index (key must not be present)
+        fn indexInsert(self: *Self, hash: u64, slot: usize) void {
+            const mask = self.index.len - 1;
+            var idx = hash & mask;
+            while (self.index[idx] >= 0) {
+                idx = (idx + 1) & mask;
+            }
+            self.index[idx] = @intCast(slot);
         }
 
-        /// Get value by key
-        pub fn get(self: *Self, key: Config.KeyType) ?Config.ValueType {
+        /// Set key-value pair
+        pub fn set(self: *Self, key: Config.KeyType, value: Config.ValueType) !void {
             const hash = Config.hashKey(key);
-            var idx = hash % self.capacity;
-            var probe_count: usize = 0;
 
-            while (probe_count < self.capacity) : (probe_count += 1) {
-                const entry = &self.entries[idx];
+            if (self.findEntry(key, hash)) |slot| {
+                // Update existing
+                const entry = &self.entries[slot];
+                Config.releaseValue(entry.value);
+                entry.value = Config.retainValue(value);
+                return;
+            }
 
-                if (!entry.used and !entry.deleted) {
-                    // Empty slot, not found
-                    return null;
-                }
+            // Grow the dense array / build or rebuild the index as needed
+            if (self.entries_len == self.entries_cap) {
+                try self.grow();
+            }
 
-                if (entry.used and entry.hash == hash and Config.keysEqual(entry.key, key)) {
-                    return entry.value;
-                }
+            const slot = self.entries_len;
+            self.entries[slot] = .{
+                .key = Config.retainKey(key),
+                .value = Config.retainValue(value),
+                .hash = hash,
+                .used = true,
+            };
+            self.entries_len += 1;
+            self.size += 1;
 
-                // Continue probing
-                idx = (idx + 1) % self.capacity;
+            if (self.index.len != 0) {
+                self.indexInsert(hash, slot);
             }
+        }
 
+        /// Get value by key
+        pub fn get(self: *Self, key: Config.KeyType) ?Config.ValueType {
+            const hash = Config.hashKey(key);
+            if (self.findEntry(key, hash)) |slot| {
+                return self.entries[slot].value;
+            }
             return null;
         }
 
@@ -135,110 +156,101 @@ pub fn DictImpl(comptime Config: type) type {
         /// Delete key-value pair
         pub fn delete(self: *Self, key: Config.KeyType) bool {
             const hash = Config.hashKey(key);
-            var idx = hash % self.capacity;
-            var probe_count: usize = 0;
-
-            while (probe_count < self.capacity) : (probe_count += 1) {
-                const entry = &self.entries[idx];
-
-                if (!entry.used and !entry.deleted) {
-                    // Not found
-                    return false;
-                }
-
-                if (entry.used and entry.hash == hash and Config.keysEqual(entry.key, key)) {
-                    // Found - mark as deleted (tombstone)
-                    Config.releaseKey(entry.key);
-                    Config.releaseValue(entry.value);
-                    entry.used = false;
-                    entry.deleted = true;
-                    self.size -= 1;
-                    return true;
+            const slot = self.findEntry(key, hash) orelse return false;
+
+            const entry = &self.entries[slot];
+            Config.releaseKey(entry.key);
+            Config.releaseValue(entry.value);
+            entry.used = false; // dense hole, squeezed out on next rebuild
+            self.size -= 1;
+
+            if (self.index.len != 0) {
+                // Tombstone the index slot so probe chains stay intact
+                const mask = self.index.len - 1;
+                var idx = hash & mask;
+                while (true) {
+                    if (self.index[idx] == @as(i32, @intCast(slot))) {
+                        self.index[idx] = DELETED;
+                        break;
+                    }
+                    idx = (idx + 1) & mask;
                 }
-
-                // Continue probing
-                idx = (idx + 1) % self.capacity;
             }
-
-            return false;
+            return true;
         }
 
         /// Clear all entries
         pub fn clear(self: *Self) void {
-            for (self.entries) |*entry| {
+            for (self.entries[0..self.entries_len]) |*entry| {
                 if (entry.used) {
                     Config.releaseKey(entry.key);
                     Config.releaseValue(entry.value);
                 }
-                entry.* = .{
-                    .key = undefined,
-                    .value = undefined,
-                    .hash = 0,
-                    .used = false,
-                    .deleted = false,
-                };
             }
+            self.entries_len = 0;
             self.size = 0;
+            if (self.index.len != 0) {
+                @memset(self.index, EMPTY);
+            }
         }
 
         /// Free all resources
         pub fn deinit(self: *Self) void {
-            for (self.entries) |*entry| {
+            for (self.entries[0..self.entries_len]) |*entry| {
                 if (entry.used) {
                     Config.releaseKey(entry.key);
                     Config.releaseValue(entry.value);
                 }
             }
             self.allocator.free(self.entries);
-        }
-
-        /// Resize hash table (double capacity)
-        fn resize(self: *Self) !void {
-            const new_capacity = self.capacity * 2;
-            const new_entries = try self.allocator.alloc(Entry, new_capacity);
-
-            // Initialize new entries
-            for (new_entries) |*entry| {
-                entry.* = .{
-                    .key = undefined,
-                    .value = undefined,
-                    .hash = 0,
-                    .used = false,
-                    .deleted = false,
-                };
+            if (self.index.len != 0) {
+                self.allocator.free(self.index);
             }
+        }
 
-            // Rehash all entries
-            for (self.entries) |entry| {
-                if (entry.used) {
-                    var idx = entry.hash % new_capacity;
-                    var probe_count: usize = 0;
-
-                    while (probe_count < new_capacity) : (probe_count += 1) {
-                        if (!new_entries[idx].used) {
-                            new_entries[idx] = entry;
-                            break;
-                        }
-                        idx = (idx + 1) % new_capacity;
+        /// Grow dense storage; compacts holes and (re)builds the index once
+        /// the dict leaves small-table territory
+        fn grow(self: *Self) !void {
+            // Squeeze out holes first - may free enough room on its own
+            if (self.size < self.entries_len) {
+                var write: usize = 0;
+                for (self.entries[0..self.entries_len]) |entry| {
+                    if (entry.used) {
+                        self.entries[write] = entry;
+                        write += 1;
                     }
                 }
+                self.entries_len = write;
+            } else {
+                const new_cap = self.entries_cap * 2;
+                const new_entries = try self.allocator.alloc(Entry, new_cap);
+                @memcpy(new_entries[0..self.entries_len], self.entries[0..self.entries_len]);
+                self.allocator.free(self.entries);
+                self.entries = new_entries;
+                self.entries_cap = new_cap;
             }
 
-            // Free old entries
-            self.allocator.free(self.entries);
-
-            // Update to new table
-            self.entries = new_entries;
-            self.capacity = new_capacity;
+            // Index holds at most 2/3 load: next power of two above 2x cap
+            if (self.entries_cap > SMALL_TABLE_MAX) {
+                const index_len = try std.math.ceilPowerOfTwo(usize, self.entries_cap * 2);
+                if (index_len != self.index.len) {
+                    if (self.index.len != 0) self.allocator.free(self.index);
+                    self.index = try self.allocator.alloc(i32, index_len);
+                }
+                @memset(self.index, EMPTY);
+                for (self.entries[0..self.entries_len], 0..) |entry, slot| {
+                    self.indexInsert(entry.hash, slot);
+                }
+            }
         }
 
-        /// Iterator over key-value pairs
+        /// Iterator over key-value pairs (insertion order)
         pub const Iterator = struct {
             dict: *Self,
             index: usize,
 
             pub fn next(iter: *Iterator) ?struct { key: Config.KeyType, value: Config.ValueType } {
-                while (iter.index < iter.dict.capacity) {
+                while (iter.index < iter.dict.entries_len) {
                     const entry = &iter.dict.entries[iter.index];
                     iter.index += 1;
 
@@ -413,3 +425,41 @@ test "DictImpl - iterator" {
 
     try std.testing.expectEqual(@as(usize, 3), count);
 }
+
+test "DictImpl - preserves insertion order across resize and delete" {
+    const Dict = DictImpl(NativeStringDictConfig);
+
+    var dict = try Dict.init(std.testing.allocator);
+    defer dict.deinit();
+
+    const keys = [_][]const u8{ "k0", "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8", "k9", "k10", "k11" };
+    for (keys) |key| {
+        try dict.set(key, key);
+    }
+    try std.testing.expect(dict.delete("k3"));
+
+    // Iteration must follow insertion order with the hole skipped
+    var iter = dict.iterator();
+    var expected: usize = 0;
+    while (iter.next()) |entry| : (expected += 1) {
+        if (expected == 3) expected += 1; // k3 was deleted
+        try std.testing.expectEqualStrings(keys[expected], entry.key);
+    }
+    try std.testing.expectEqual(@as(usize, 12), expected);
+}
+
+test "DictImpl - delete and reinsert in small table" {
+    const Dict = DictImpl(NativeStringDictConfig);
+
+    var dict = try Dict.init(std.testing.allocator);
+    defer dict.deinit();
+
+    try dict.set("a", "1");
+    try dict.set("b", "2");
+    try std.testing.expect(dict.delete("a"));
+    try dict.set("a", "3");
+
+    try std.testing.expectEqual(@as(usize, 2), dict.size);
+    try std.testing.expectEqualStrings("3", dict.get("a").?);
+    try std.testing.expectEqualStrings("2", dict.get("b").?);
+}
@@ -96,6 +96,58 @@ pub const Expr = union(enum) {
     }
 };
 
+/// Extract the literal byte prefix that every match of `expr` must start
+/// with. Returns null when there is no mandatory prefix (alternation, class
+/// or optional term in leading position). Caller frees the returned slice.
+pub fn requiredPrefix(allocator: std.mem.Allocator, expr: Expr) !?[]u8 {
+    var bytes = std.ArrayList(u8){};
+    errdefer bytes.deinit(allocator);
+
+    _ = try collectPrefix(&bytes, allocator, expr);
+
+    if (bytes.items.len == 0) {
+        bytes.deinit(allocator);
+        return null;
+    }
+    return try bytes.toOwnedSlice(allocator);
+}
+
+/// Append the mandatory leading literal bytes of `expr`.
+/// Returns true if the expression is fully fixed, meaning a following
+/// sibling in a concat may extend the prefix further.
+fn collectPrefix(bytes: *std.ArrayList(u8), allocator: std.mem.Allocator, expr: Expr) !bool {
+    switch (expr) {
+        .char => |c| {
+            try bytes.append(allocator, c);
+            return true;
+        },
+        // Zero-width: does not break the literal run
+        .start => return true,
+        .group => |sub| return try collectPrefix(bytes, allocator, sub.*),
+        .concat => |c| {
+            for (c.exprs) |e| {
+                if (!try collectPrefix(bytes, allocator, e)) return false;
+            }
+            return true;
+        },
+        // e+ requires at least one e, but the repetition end is variable
+        .plus => |sub| {
+            _ = try collectPrefix(bytes, allocator, sub.*);
+            return false;
+        },
+        // e{n,m} with n >= 1 requires one leading e
+        .repeat => |r| {
+            if (r.min >= 1) {
+                _ = try collectPrefix(bytes, allocator, r.expr.*);
+            }
+            return false;
+        },
+        // Anything else (classes, alternation, optional terms, anchors at
+        // arbitrary positions) ends the mandatory prefix
+        else => return false,
+    }
+}
+
 /// Full AST (owns all expressions)
 pub const AST = struct {
     root: Expr,
@@ -112,3 +164,41 @@ pub const AST = struct {
         self.root.deinit(self.allocator);
     }
 };
+
+test "requiredPrefix of literal concat" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "ERROR: \\d+");
+    var tree = try p.parse();
+    defer tree.deinit();
+
+    const prefix = (try requiredPrefix(allocator, tree.root)).?;
+    defer allocator.free(prefix);
+    try std.testing.expectEqualStrings("ERROR: ", prefix);
+}
+
+test "requiredPrefix stops at variable terms" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    // a+ requires at least one 'a' but nothing after is mandatory
+    var p = parser.Parser.init(allocator, "a+bc");
+    var tree = try p.parse();
+    defer tree.deinit();
+
+    const prefix = (try requiredPrefix(allocator, tree.root)).?;
+    defer allocator.free(prefix);
+    try std.testing.expectEqualStrings("a", prefix);
+}
+
+test "requiredPrefix is null for alternation" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "cat|dog");
+    var tree = try p.parse();
+    defer tree.deinit();
+
+    try std.testing.expectEqual(@as(?[]u8, null), try requiredPrefix(allocator, tree.root));
+}
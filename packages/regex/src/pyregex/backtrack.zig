@@ -0,0 +1,319 @@
+/// Bounded backtracking engine (RE2 "BitState" style)
+/// Runs the NFA by depth-first search with a visited bitmap over
+/// (state, position) pairs, so total work is capped at the same
+/// O(states x text) bound as the PikeVM - but each step pops one work
+/// item touching one capture slot in place, instead of cloning a
+/// MAX_CAPTURES span array per thread per byte. On the small anchored
+/// patterns our extraction pipelines use, this runs groups at close to
+/// plain-search speed.
+///
+/// Selected by Regex when states x positions fits MAX_VISITED_BITS
+/// (see regex.zig); larger products stay on the PikeVM.
+const std = @import("std");
+const nfa_mod = @import("nfa.zig");
+const pikevm = @import("pikevm.zig");
+
+const NFA = nfa_mod.NFA;
+const StateId = nfa_mod.StateId;
+const MATCH_STATE = nfa_mod.MATCH_STATE;
+const Match = pikevm.Match;
+const Span = pikevm.Span;
+const MAX_CAPTURES = pikevm.MAX_CAPTURES;
+
+/// Work budget: states x (text length + 1) must fit this many visited
+/// bits for the backtracker to be eligible (64KB bitmap at the limit)
+pub const MAX_VISITED_BITS: usize = 1 << 19;
+
+fn isWordChar(c: u8) bool {
+    return (c >= 'a' and c <= 'z') or
+        (c >= 'A' and c <= 'Z') or
+        (c >= '0' and c <= '9') or
+        c == '_';
+}
+
+fn isAtWordBoundary(text: []const u8, pos: usize) bool {
+    const before_is_word = if (pos == 0) false else isWordChar(text[pos - 1]);
+    const after_is_word = if (pos >= text.len) false else isWordChar(text[pos]);
+    return before_is_word != after_is_word;
+}
+
+pub const BoundedBacktracker = struct {
+    nfa: *const NFA,
+    allocator: std.mem.Allocator,
+
+    /// One pending step of the depth-first walk. The DFS runs on an
+    /// explicit heap stack: recursing once per consumed byte would
+    /// overflow thread stacks (and 256KB green-thread stacks much
+    /// sooner) on texts in the 100KB range that still fit the bitmap
+    /// budget. A restore entry undoes a capture-slot write once the
+    /// subtree pushed above it has been exhausted.
+    const Job = union(enum) {
+        visit: struct { state: StateId, pos: usize },
+        save: struct { slot: u32, target: StateId, pos: usize },
+        restore: struct { group: usize, span: Span },
+    };
+
+    // Per-search state (set up by findFrom)
+    text: []const u8 = "",
+    visited: []u64 = &.{},
+    captures: [MAX_CAPTURES]Span = undefined,
+    best_captures: [MAX_CAPTURES]Span = undefined,
+    best_end: usize = 0,
+    has_match: bool = false,
+
+    pub fn init(allocator: std.mem.Allocator, nfa_ptr: *const NFA) BoundedBacktracker {
+        return .{
+            .nfa = nfa_ptr,
+            .allocator = allocator,
+        };
+    }
+
+    /// Whether this pattern/text pair fits the visited-bit budget
+    pub fn suitable(nfa_ptr: *const NFA, text_len: usize) bool {
+        const states = nfa_ptr.states.len;
+        if (states == 0) return false;
+        return states * (text_len + 1) <= MAX_VISITED_BITS;
+    }
+
+    /// Find first match in text
+    pub fn find(self: *BoundedBacktracker, text: []const u8) !?Match {
+        return self.findFrom(text, 0);
+    }
+
+    /// Find first match starting from a given position.
+    /// The bitmap is shared across start offsets (a (state, pos) pair
+    /// that failed from an earlier start fails from every later one),
+    /// which is what bounds the whole scan to one pass.
+    pub fn findFrom(self: *BoundedBacktracker, text: []const u8, from: usize) !?Match {
+        const words = (self.nfa.states.len * (text.len + 1) + 63) / 64;
+        self.visited = try self.allocator.alloc(u64, words);
+        defer self.allocator.free(self.visited);
+        @memset(self.visited, 0);
+
+        self.text = text;
+
+        var jobs = std.ArrayList(Job){};
+        defer jobs.deinit(self.allocator);
+
+        var start = from;
+        while (start <= text.len) : (start += 1) {
+            self.has_match = false;
+            for (&self.captures) |*cap| {
+                cap.* = Span.init(0, 0);
+            }
+            self.captures[0] = Span.init(start, start);
+
+            try self.walk(&jobs, self.nfa.start, start);
+
+            if (self.has_match) {
+                const captures = try self.allocator.alloc(Span, self.nfa.num_captures + 1);
+                @memcpy(captures, self.best_captures[0 .. self.nfa.num_captures + 1]);
+                captures[0] = Span.init(start, self.best_end);
+                return Match{
+                    .span = captures[0],
+                    .captures = captures,
+                };
+            }
+        }
+        return null;
+    }
+
+    /// Depth-first walk from (state, pos), driven by the job stack;
+    /// records the longest match reached, mirroring the PikeVM's
+    /// greedy semantics. Popping a save job here is the moment the
+    /// recursive formulation would enter the save transition, so the
+    /// previous slot value is read then, not at push time.
+    fn walk(self: *BoundedBacktracker, jobs: *std.ArrayList(Job), state_id: StateId, pos: usize) error{OutOfMemory}!void {
+        try jobs.append(self.allocator, .{ .visit = .{ .state = state_id, .pos = pos } });
+
+        while (jobs.pop()) |job| {
+            switch (job) {
+                .restore => |r| self.captures[r.group] = r.span,
+                .save => |s| {
+                    // Write the slot in place; the restore sits below
+                    // this subtree on the stack, so it undoes the write
+                    // only once every path through it is exhausted and
+                    // sibling branches see the previous value
+                    const group = s.slot / 2;
+                    if (group < MAX_CAPTURES) {
+                        try jobs.append(self.allocator, .{ .restore = .{ .group = group, .span = self.captures[group] } });
+                        if (s.slot % 2 == 0) {
+                            self.captures[group] = Span.init(s.pos, s.pos);
+                        } else {
+                            self.captures[group].end = s.pos;
+                        }
+                    }
+                    try jobs.append(self.allocator, .{ .visit = .{ .state = s.target, .pos = s.pos } });
+                },
+                .visit => |v| try self.visitState(jobs, v.state, v.pos),
+            }
+        }
+    }
+
+    /// Expand one (state, pos) pair, pushing successor jobs.
+    /// Transitions are pushed in reverse so the first one is popped
+    /// first, preserving the recursive exploration order.
+    fn visitState(self: *BoundedBacktracker, jobs: *std.ArrayList(Job), state_id: StateId, pos: usize) error{OutOfMemory}!void {
+        if (state_id == MATCH_STATE) {
+            if (!self.has_match or pos > self.best_end) {
+                self.has_match = true;
+                self.best_end = pos;
+                self.best_captures = self.captures;
+            }
+            return;
+        }
+        if (state_id >= self.nfa.states.len) return;
+
+        // Already explored this (state, pos) on some path: the
+        // continuation is identical, and like the PikeVM's sparse-set
+        // dedup, the first path to claim a pair keeps its captures
+        const bit = state_id * (self.text.len + 1) + pos;
+        const mask = @as(u64, 1) << @intCast(bit % 64);
+        if (self.visited[bit / 64] & mask != 0) return;
+        self.visited[bit / 64] |= mask;
+
+        const state = &self.nfa.states[state_id];
+        var i = state.transitions.len;
+        while (i > 0) {
+            i -= 1;
+            switch (state.transitions[i]) {
+                .byte => |b| {
+                    if (pos < self.text.len and self.text[pos] == b.value) {
+                        try jobs.append(self.allocator, .{ .visit = .{ .state = b.target, .pos = pos + 1 } });
+                    }
+                },
+                .range => |r| {
+                    if (pos < self.text.len and self.text[pos] >= r.start and self.text[pos] <= r.end) {
+                        try jobs.append(self.allocator, .{ .visit = .{ .state = r.target, .pos = pos + 1 } });
+                    }
+                },
+                .any => |target| {
+                    if (pos < self.text.len) {
+                        try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos + 1 } });
+                    }
+                },
+                .epsilon => |target| try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos } }),
+                .split => |s| {
+                    var j = s.targets.len;
+                    while (j > 0) {
+                        j -= 1;
+                        try jobs.append(self.allocator, .{ .visit = .{ .state = s.targets[j], .pos = pos } });
+                    }
+                },
+                .start_assert => |target| {
+                    if (pos == 0) try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos } });
+                },
+                .end_assert => |target| {
+                    if (pos == self.text.len) try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos } });
+                },
+                .word_boundary => |target| {
+                    if (isAtWordBoundary(self.text, pos)) try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos } });
+                },
+                .not_word_boundary => |target| {
+                    if (!isAtWordBoundary(self.text, pos)) try jobs.append(self.allocator, .{ .visit = .{ .state = target, .pos = pos } });
+                },
+                .save => |s| try jobs.append(self.allocator, .{ .save = .{ .slot = s.slot, .target = s.target, .pos = pos } }),
+                .match => {},
+            }
+        }
+    }
+};
+
+// Tests
+test "backtracker literal match" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "hello");
+    var ast = try p.parse();
+    defer ast.deinit();
+
+    var builder = nfa_mod.Builder.init(allocator);
+    var nfa_instance = try builder.build(ast.root);
+    defer nfa_instance.deinit();
+
+    var bt = BoundedBacktracker.init(allocator, &nfa_instance);
+    const result = try bt.find("say hello world");
+    try std.testing.expect(result != null);
+
+    var match = result.?;
+    defer match.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 4), match.span.start);
+    try std.testing.expectEqual(@as(usize, 9), match.span.end);
+}
+
+test "backtracker capture group" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "(a+)b");
+    var ast = try p.parse();
+    defer ast.deinit();
+
+    var builder = nfa_mod.Builder.init(allocator);
+    var nfa_instance = try builder.build(ast.root);
+    defer nfa_instance.deinit();
+
+    var bt = BoundedBacktracker.init(allocator, &nfa_instance);
+    const result = try bt.find("xaaab");
+    try std.testing.expect(result != null);
+
+    var match = result.?;
+    defer match.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 1), match.span.start);
+    try std.testing.expectEqual(@as(usize, 5), match.span.end);
+    // Group 1 captured "aaa"
+    try std.testing.expectEqual(@as(usize, 1), match.captures[1].start);
+    try std.testing.expectEqual(@as(usize, 4), match.captures[1].end);
+}
+
+test "backtracker deep walk stays off the call stack" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "a*");
+    var ast = try p.parse();
+    defer ast.deinit();
+
+    var builder = nfa_mod.Builder.init(allocator);
+    var nfa_instance = try builder.build(ast.root);
+    defer nfa_instance.deinit();
+
+    // One visit per consumed byte: recursion would nest ~20k frames
+    // here, too deep for a green-thread stack
+    const text = try allocator.alloc(u8, 20_000);
+    defer allocator.free(text);
+    @memset(text, 'a');
+    try std.testing.expect(BoundedBacktracker.suitable(&nfa_instance, text.len));
+
+    var bt = BoundedBacktracker.init(allocator, &nfa_instance);
+    const result = try bt.find(text);
+    try std.testing.expect(result != null);
+
+    var match = result.?;
+    defer match.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 0), match.span.start);
+    try std.testing.expectEqual(text.len, match.span.end);
+}
+
+test "backtracker greedy quantifier" {
+    const allocator = std.testing.allocator;
+    const parser = @import("parser.zig");
+
+    var p = parser.Parser.init(allocator, "a*");
+    var ast = try p.parse();
+    defer ast.deinit();
+
+    var builder = nfa_mod.Builder.init(allocator);
+    var nfa_instance = try builder.build(ast.root);
+    defer nfa_instance.deinit();
+
+    var bt = BoundedBacktracker.init(allocator, &nfa_instance);
+    const result = try bt.find("aaa");
+    try std.testing.expect(result != null);
+
+    var match = result.?;
+    defer match.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 0), match.span.start);
+    try std.testing.expectEqual(@as(usize, 3), match.span.end);
+}
@@ -218,6 +218,12 @@ pub const LazyDFA = struct {
     prefix_window_before: usize,
     prefix_window_after: usize,
 
+    /// Required literal the pattern must START with (from ast.requiredPrefix).
+    /// Stronger than prefix_literal: matches can only begin at occurrences of
+    /// this literal, so the scan jumps between them with memchr/SIMD search
+    /// instead of stepping the DFA one byte per position.
+    required_prefix: ?[]const u8,
+
     /// SIMD fast path for URL pattern (scan until whitespace)
     use_url_fast_path: bool,
 
@@ -236,6 +242,7 @@ pub const LazyDFA = struct {
             .prefix_literal = null,
             .prefix_window_before = 5,
             .prefix_window_after = 5,
+            .required_prefix = null,
             .use_url_fast_path = false,
             .use_digits_fast_path = false,
             .use_word_boundary_fast_path = false,
@@ -249,6 +256,13 @@ pub const LazyDFA = struct {
         self.prefix_literal = literal;
     }
 
+    /// Set the required leading literal (pattern starts with it).
+    /// Candidate positions come from SIMD substring search; the DFA only
+    /// runs where the literal actually occurs.
+    pub fn setRequiredPrefix(self: *LazyDFA, literal: []const u8) void {
+        self.required_prefix = literal;
+    }
+
     pub fn setPrefixWithWindow(self: *LazyDFA, literal: []const u8, before: usize, after: usize) void {
         self.prefix_literal = literal;
         self.prefix_window_before = before;
@@ -277,6 +291,19 @@ pub const LazyDFA = struct {
 
     /// Find first match in text
     pub fn find(self: *LazyDFA, text: []const u8) !?Match {
+        // Matches can only begin at the required literal: jump between its
+        // occurrences with SIMD substring search instead of stepping the DFA
+        if (self.required_prefix) |prefix| {
+            var pos: usize = 0;
+            while (std.mem.indexOfPos(u8, text, pos, prefix)) |found| {
+                if (try self.findAt(text, found)) |match| {
+                    return match;
+                }
+                pos = found + 1;
+            }
+            return null;
+        }
+
         // Try matching at each starting position
         var start: usize = 0;
         while (start <= text.len) : (start += 1) {
@@ -287,6 +314,12 @@ pub const LazyDFA = struct {
         return null;
     }
 
+    /// Try to match starting exactly at `start` (public for the multi-pattern
+    /// front end, which verifies Aho-Corasick candidates this way)
+    pub fn matchAt(self: *LazyDFA, text: []const u8, start: usize) !?Match {
+        return self.findAt(text, start);
+    }
+
     /// Find all matches in text (like Rust find_iter)
     pub fn findAll(self: *LazyDFA, text: []const u8, allocator: std.mem.Allocator) ![]Match {
         if (text.len == 0) return allocator.alloc(Match, 0);
@@ -311,6 +344,11 @@ pub const LazyDFA = struct {
             return try self.findAllUrlFastPath(text, allocator);
         }
 
+        // Required leading literal: strongest hint, matches only start there
+        if (self.required_prefix) |prefix| {
+            return try self.findAllAnchoredPrefix(text, allocator, prefix);
+        }
+
         // Use prefix scanning if available
         if (self.prefix_literal) |prefix| {
             return try self.findAllWithPrefix(text, allocator, prefix);
@@ -374,6 +412,29 @@ pub const LazyDFA = struct {
         return matches.toOwnedSlice(allocator);
     }
 
+    /// Find all matches when the pattern starts with a fixed literal.
+    /// std.mem.indexOfPos (SIMD/memchr under the hood) jumps straight to
+    /// candidate positions; the DFA runs only at literal occurrences.
+    fn findAllAnchoredPrefix(self: *LazyDFA, text: []const u8, allocator: std.mem.Allocator, prefix: []const u8) ![]Match {
+        var matches = std.ArrayList(Match){};
+
+        var pos: usize = 0;
+        while (pos + prefix.len <= text.len) {
+            const found = std.mem.indexOfPos(u8, text, pos, prefix) orelse break;
+
+            if (try self.findAt(text, found)) |match| {
+                try matches.append(allocator, match);
+                // Non-overlapping: resume after the match (always progresses
+                // since the match covers at least the literal)
+                pos = if (match.end > found) match.end else found + 1;
+            } else {
+                pos = found + 1;
+            }
+        }
+
+        return matches.toOwnedSlice(allocator);
+    }
+
     /// Find all matches using prefix literal scanning (FAST PATH)
     fn findAllWithPrefix(self: *LazyDFA, text: []const u8, allocator: std.mem.Allocator, prefix: []const u8) ![]Match {
         var matches = std.ArrayList(Match){};
@@ -731,6 +792,11 @@ pub const LazyDFA = struct {
                     // For now, skip them (this is a simplification)
                     has_epsilon = true;
                 },
+                .save => |s| {
+                    // The DFA tracks no captures - pass through as epsilon
+                    has_epsilon = true;
+                    try self.epsilonClosureHelper(result, visited, s.target);
+                },
                 else => {},
             }
         }
@@ -0,0 +1,346 @@
+/// Multi-pattern front end - compiles a list of patterns into one scanner
+///
+/// Every pattern's required leading literal (ast.requiredPrefix) is fed into
+/// an Aho-Corasick automaton, so one pass over the text yields candidate
+/// positions for ALL patterns at once; each candidate is then verified by
+/// that pattern's lazy DFA anchored at the position. Patterns without a
+/// required literal fall back to their own DFA scan and the results are
+/// merged.
+///
+/// The automaton is a compact port of the Aho-Corasick machinery in
+/// packages/tokenizer/src/aho_corasick.zig (trie + BFS failure links); the
+/// tokenizer's double-array version lives in a different module root and the
+/// regex package is copied standalone into .build, so it cannot be imported
+/// from here.
+const std = @import("std");
+const parser = @import("parser.zig");
+const ast_mod = @import("ast.zig");
+const nfa_mod = @import("nfa.zig");
+const lazydfa = @import("lazydfa.zig");
+
+/// A match annotated with the pattern that produced it
+pub const MultiMatch = struct {
+    pattern_index: usize,
+    start: usize,
+    end: usize,
+};
+
+/// Trie-based Aho-Corasick over the required literals
+const LiteralSet = struct {
+    const TrieState = struct {
+        children: std.AutoHashMap(u8, u32),
+        fail: u32,
+        /// Pattern indices whose literal ends in this state
+        outputs: std.ArrayList(u32),
+    };
+
+    states: std.ArrayList(TrieState),
+    /// Literal length per pattern index (to recover candidate start positions)
+    literal_lens: []usize,
+    allocator: std.mem.Allocator,
+
+    fn init(allocator: std.mem.Allocator, literals: []const []const u8) !LiteralSet {
+        var self = LiteralSet{
+            .states = std.ArrayList(TrieState){},
+            .literal_lens = try allocator.alloc(usize, literals.len),
+            .allocator = allocator,
+        };
+        errdefer self.deinit();
+
+        try self.addState(); // root
+
+        // Trie insertion
+        for (literals, 0..) |literal, pattern_index| {
+            self.literal_lens[pattern_index] = literal.len;
+            var state: u32 = 0;
+            for (literal) |c| {
+                if (self.states.items[state].children.get(c)) |next| {
+                    state = next;
+                } else {
+                    const next = try self.addState();
+                    try self.states.items[state].children.put(c, next);
+                    state = next;
+                }
+            }
+            try self.states.items[state].outputs.append(allocator, @intCast(pattern_index));
+        }
+
+        // BFS failure links (root's children fail to root)
+        var queue = std.ArrayList(u32){};
+        defer queue.deinit(allocator);
+
+        var root_it = self.states.items[0].children.iterator();
+        while (root_it.next()) |entry| {
+            try queue.append(allocator, entry.value_ptr.*);
+        }
+
+        var head: usize = 0;
+        while (head < queue.items.len) : (head += 1) {
+            const state = queue.items[head];
+            var it = self.states.items[state].children.iterator();
+            while (it.next()) |entry| {
+                const c = entry.key_ptr.*;
+                const child = entry.value_ptr.*;
+                try queue.append(self.allocator, child);
+
+                // Follow failure chain of the parent to find the child's link
+                var fail = self.states.items[state].fail;
+                while (fail != 0 and self.states.items[fail].children.get(c) == null) {
+                    fail = self.states.items[fail].fail;
+                }
+                self.states.items[child].fail = self.states.items[fail].children.get(c) orelse 0;
+            }
+        }
+
+        return self;
+    }
+
+    fn addState(self: *LiteralSet) !u32 {
+        const id: u32 = @intCast(self.states.items.len);
+        try self.states.append(self.allocator, .{
+            .children = std.AutoHashMap(u8, u32).init(self.allocator),
+            .fail = 0,
+            .outputs = std.ArrayList(u32){},
+        });
+        return id;
+    }
+
+    fn deinit(self: *LiteralSet) void {
+        for (self.states.items) |*state| {
+            state.children.deinit();
+            state.outputs.deinit(self.allocator);
+        }
+        self.states.deinit(self.allocator);
+        self.allocator.free(self.literal_lens);
+    }
+
+    /// Advance the automaton by one byte
+    fn step(self: *const LiteralSet, state: u32, c: u8) u32 {
+        var s = state;
+        while (true) {
+            if (self.states.items[s].children.get(c)) |next| return next;
+            if (s == 0) return 0;
+            s = self.states.items[s].fail;
+        }
+    }
+
+    /// Call `sink` for every (pattern_index, literal_start) at this state,
+    /// including literals reachable through failure links
+    fn emit(self: *const LiteralSet, state: u32, end_pos: usize, sink: anytype) !void {
+        var s = state;
+        while (s != 0) {
+            for (self.states.items[s].outputs.items) |pattern_index| {
+                const len = self.literal_lens[pattern_index];
+                try sink.candidate(pattern_index, end_pos + 1 - len);
+            }
+            s = self.states.items[s].fail;
+        }
+    }
+};
+
+/// One compiled member pattern
+const CompiledPattern = struct {
+    nfa: *nfa_mod.NFA,
+    dfa: lazydfa.LazyDFA,
+    /// Required leading literal, null when the pattern has none
+    prefix: ?[]u8,
+};
+
+pub const MultiRegex = struct {
+    allocator: std.mem.Allocator,
+    patterns: []CompiledPattern,
+    /// Aho-Corasick over required literals; null when any pattern lacks one
+    literal_set: ?LiteralSet,
+
+    pub fn compile(allocator: std.mem.Allocator, patterns: []const []const u8) !MultiRegex {
+        var compiled = try allocator.alloc(CompiledPattern, patterns.len);
+        var count: usize = 0;
+        errdefer {
+            for (compiled[0..count]) |*cp| {
+                cp.dfa.deinit();
+                cp.nfa.deinit();
+                allocator.destroy(cp.nfa);
+                if (cp.prefix) |p| allocator.free(p);
+            }
+            allocator.free(compiled);
+        }
+
+        var all_have_prefix = true;
+        for (patterns, 0..) |pattern, i| {
+            var p = parser.Parser.init(allocator, pattern);
+            var tree = try p.parse();
+            defer tree.deinit();
+
+            const prefix = try ast_mod.requiredPrefix(allocator, tree.root);
+            // Not yet owned by compiled[i]: free it ourselves if the
+            // NFA build below fails
+            errdefer if (prefix) |p| allocator.free(p);
+            if (prefix == null) all_have_prefix = false;
+
+            // NFA lives on the heap so the DFA's pointer stays stable
+            const nfa = try allocator.create(nfa_mod.NFA);
+            errdefer allocator.destroy(nfa);
+            var builder = nfa_mod.Builder.init(allocator);
+            nfa.* = try builder.build(tree.root);
+
+            compiled[i] = .{
+                .nfa = nfa,
+                .dfa = lazydfa.LazyDFA.init(allocator, nfa),
+                .prefix = prefix,
+            };
+            if (prefix) |lit| compiled[i].dfa.setRequiredPrefix(lit);
+            count = i + 1;
+        }
+
+        var literal_set: ?LiteralSet = null;
+        if (all_have_prefix and patterns.len > 0) {
+            const literals = try allocator.alloc([]const u8, patterns.len);
+            defer allocator.free(literals);
+            for (compiled, 0..) |cp, i| literals[i] = cp.prefix.?;
+            literal_set = try LiteralSet.init(allocator, literals);
+        }
+
+        return .{
+            .allocator = allocator,
+            .patterns = compiled,
+            .literal_set = literal_set,
+        };
+    }
+
+    pub fn deinit(self: *MultiRegex) void {
+        for (self.patterns) |*cp| {
+            cp.dfa.deinit();
+            cp.nfa.deinit();
+            self.allocator.destroy(cp.nfa);
+            if (cp.prefix) |p| self.allocator.free(p);
+        }
+        self.allocator.free(self.patterns);
+        if (self.literal_set) |*ls| ls.deinit();
+    }
+
+    /// Find all non-overlapping matches of every pattern, ordered by start
+    /// position. Overlap is only suppressed within a pattern - two different
+    /// patterns may match the same bytes.
+    pub fn findAll(self: *MultiRegex, text: []const u8, allocator: std.mem.Allocator) ![]MultiMatch {
+        var matches = std.ArrayList(MultiMatch){};
+        errdefer matches.deinit(allocator);
+
+        if (self.literal_set) |*ls| {
+            // Single Aho-Corasick pass yields candidates for all patterns
+            const next_allowed = try self.allocator.alloc(usize, self.patterns.len);
+            defer self.allocator.free(next_allowed);
+            @memset(next_allowed, 0);
+
+            const Sink = struct {
+                multi: *MultiRegex,
+                text: []const u8,
+                matches: *std.ArrayList(MultiMatch),
+                next_allowed: []usize,
+                out_allocator: std.mem.Allocator,
+
+                fn candidate(sink: *@This(), pattern_index: usize, start: usize) !void {
+                    if (start < sink.next_allowed[pattern_index]) return;
+                    const dfa = &sink.multi.patterns[pattern_index].dfa;
+                    if (try dfa.matchAt(sink.text, start)) |m| {
+                        try sink.matches.append(sink.out_allocator, .{
+                            .pattern_index = pattern_index,
+                            .start = m.start,
+                            .end = m.end,
+                        });
+                        sink.next_allowed[pattern_index] = @max(m.end, start + 1);
+                    }
+                }
+            };
+            var sink = Sink{
+                .multi = self,
+                .text = text,
+                .matches = &matches,
+                .next_allowed = next_allowed,
+                .out_allocator = allocator,
+            };
+
+            var state: u32 = 0;
+            for (text, 0..) |c, pos| {
+                state = ls.step(state, c);
+                try ls.emit(state, pos, &sink);
+            }
+        } else {
+            // Mixed set: scan per pattern, then merge
+            for (self.patterns, 0..) |*cp, pattern_index| {
+                const found = try cp.dfa.findAll(text, self.allocator);
+                defer self.allocator.free(found);
+                for (found) |m| {
+                    try matches.append(allocator, .{
+                        .pattern_index = pattern_index,
+                        .start = m.start,
+                        .end = m.end,
+                    });
+                }
+            }
+        }
+
+        std.mem.sort(MultiMatch, matches.items, {}, lessThan);
+        return matches.toOwnedSlice(allocator);
+    }
+
+    fn lessThan(_: void, a: MultiMatch, b: MultiMatch) bool {
+        if (a.start != b.start) return a.start < b.start;
+        if (a.end != b.end) return a.end < b.end;
+        return a.pattern_index < b.pattern_index;
+    }
+};
+
+test "multi-pattern scan with literal prefixes" {
+    const allocator = std.testing.allocator;
+
+    var multi = try MultiRegex.compile(allocator, &.{ "ERROR: \\d+", "WARN: \\d+" });
+    defer multi.deinit();
+
+    const text = "ok\nERROR: 17 things\nWARN: 3\nERROR: 9";
+    const matches = try multi.findAll(text, allocator);
+    defer allocator.free(matches);
+
+    try std.testing.expectEqual(@as(usize, 3), matches.len);
+
+    try std.testing.expectEqual(@as(usize, 0), matches[0].pattern_index);
+    try std.testing.expectEqualStrings("ERROR: 17", text[matches[0].start..matches[0].end]);
+
+    try std.testing.expectEqual(@as(usize, 1), matches[1].pattern_index);
+    try std.testing.expectEqualStrings("WARN: 3", text[matches[1].start..matches[1].end]);
+
+    try std.testing.expectEqual(@as(usize, 0), matches[2].pattern_index);
+    try std.testing.expectEqualStrings("ERROR: 9", text[matches[2].start..matches[2].end]);
+}
+
+test "multi-pattern falls back when a pattern has no literal" {
+    const allocator = std.testing.allocator;
+
+    var multi = try MultiRegex.compile(allocator, &.{ "cat|dog", "fish" });
+    defer multi.deinit();
+
+    try std.testing.expect(multi.literal_set == null);
+
+    const text = "a dog and a fish";
+    const matches = try multi.findAll(text, allocator);
+    defer allocator.free(matches);
+
+    try std.testing.expectEqual(@as(usize, 2), matches.len);
+    try std.testing.expectEqualStrings("dog", text[matches[0].start..matches[0].end]);
+    try std.testing.expectEqualStrings("fish", text[matches[1].start..matches[1].end]);
+}
+
+test "shared literal prefix candidates verify correctly" {
+    const allocator = std.testing.allocator;
+
+    // Both literals start with "ab" - failure links must still surface both
+    var multi = try MultiRegex.compile(allocator, &.{ "abc\\d", "bc\\d\\d" });
+    defer multi.deinit();
+
+    const text = "xx abc1 bc22 xx";
+    const matches = try multi.findAll(text, allocator);
+    defer allocator.free(matches);
+
+    try std.testing.expectEqual(@as(usize, 2), matches.len);
+    try std.testing.expectEqualStrings("abc1", text[matches[0].start..matches[0].end]);
+    try std.testing.expectEqualStrings("bc22", text[matches[1].start..matches[1].end]);
+}
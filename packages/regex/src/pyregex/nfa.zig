@@ -51,10 +51,23 @@ pub const Transition = union(enum) {
     /// Not word boundary assertion (\B) - matches NOT at word boundary
     not_word_boundary: StateId,
 
+    /// Capture-slot write (epsilon move): record the current position
+    /// into a capture slot, then continue. Slot 2g marks the start of
+    /// group g, slot 2g+1 its end (group 0 is the full match).
+    save: struct {
+        slot: u32,
+        target: StateId,
+    },
+
     /// Match state - accept the input
     match: void,
 };
 
+/// Highest numbered group that gets capture slots; groups beyond this
+/// still match but are not recorded (pikevm.MAX_CAPTURES holds slots
+/// for the full match plus MAX_GROUPS numbered groups)
+pub const MAX_GROUPS = 31;
+
 /// A state in the NFA
 pub const State = struct {
     /// Unique state ID
@@ -247,6 +260,11 @@ pub const Builder = struct {
                             t.* = target;
                         }
                     },
+                    .save => |*s| {
+                        if (s.target == DANGLING) {
+                            s.target = target;
+                        }
+                    },
                     .match => {},
                 }
             }
@@ -526,8 +544,15 @@ pub const Builder = struct {
             fragments.deinit(self.allocator);
         }
 
+        // Each copy re-compiles the sub-expression; reset the group
+        // counter per copy so (e){3} numbers e's groups once, with every
+        // copy writing the same capture slots (last iteration wins, as
+        // in Python)
+        const group_base = self.next_capture_group;
+
         // Add minimum required copies
         for (0..repeat.min) |_| {
+            self.next_capture_group = group_base;
             const frag = try self.compile(repeat.expr.*);
             try fragments.append(self.allocator, frag);
         }
@@ -537,12 +562,14 @@ pub const Builder = struct {
             if (max > repeat.min) {
                 // Add (max - min) optional copies (each wrapped in ?)
                 for (repeat.min..max) |_| {
+                    self.next_capture_group = group_base;
                     const frag = try self.compileQuestion(repeat.expr.*);
                     try fragments.append(self.allocator, frag);
                 }
             }
         } else {
             // Unbounded: add one * copy
+            self.next_capture_group = group_base;
             const frag = try self.compileStar(repeat.expr.*);
             try fragments.append(self.allocator, frag);
         }
@@ -640,10 +667,42 @@ pub const Builder = struct {
     }
 
     /// Compile (e) (capturing group)
+    /// Wraps the sub-expression in a pair of save states that record the
+    /// group's start and end positions as epsilon moves
     fn compileGroup(self: *Builder, expr: Expr) !Fragment {
-        _ = expr;
-        // TODO: Implement with capture group tracking
-        return try self.compileAny();
+        self.next_capture_group += 1;
+        const group = self.next_capture_group;
+
+        // Out of capture slots: still match, just don't record the span
+        if (group > MAX_GROUPS) {
+            return try self.compile(expr);
+        }
+
+        const open_trans = try self.allocator.alloc(Transition, 1);
+        open_trans[0] = Transition{ .save = .{ .slot = 2 * group, .target = DANGLING } };
+        const open_state = try self.newState(open_trans);
+
+        const frag = try self.compile(expr);
+
+        // open -> sub-expression start
+        self.states.items[open_state].transitions[0].save.target = frag.start;
+
+        const close_trans = try self.allocator.alloc(Transition, 1);
+        close_trans[0] = Transition{ .save = .{ .slot = 2 * group + 1, .target = DANGLING } };
+        const close_state = try self.newState(close_trans);
+
+        // sub-expression outs -> close
+        try self.patch(frag.out_states, close_state);
+        var sub_outs = frag.out_states;
+        sub_outs.deinit(self.allocator);
+
+        var out_states: std.ArrayList(StateId) = .{};
+        try out_states.append(self.allocator, close_state);
+
+        return Fragment{
+            .start = open_state,
+            .out_states = out_states,
+        };
     }
 
     /// Compile ^ (start anchor)
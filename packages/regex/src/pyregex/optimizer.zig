@@ -17,6 +17,9 @@ pub const Strategy = enum {
     word_boundary,
     /// Use prefix scanning with DFA
     prefix_scan,
+    /// Pattern starts with a fixed literal: memchr-skip to occurrences,
+    /// run the DFA only there (LazyDFA.setRequiredPrefix)
+    anchored_prefix,
 };
 
 /// Detected optimization info
@@ -65,6 +68,18 @@ pub fn analyze(allocator: std.mem.Allocator, ast: *const AST) !OptimizationInfo
         return info;
     }
 
+    // Required leading literal (e.g. "ERROR: \d+"): matches can only start
+    // at the literal, so the DFA is skipped between occurrences entirely
+    if (try ast_mod.requiredPrefix(allocator, ast.root)) |literal| {
+        if (literal.len >= 2) {
+            info.strategy = .anchored_prefix;
+            info.prefix_literal = literal;
+            return info;
+        }
+        // Single byte gives too many candidates to be worth anchoring
+        allocator.free(literal);
+    }
+
     // Fallback: lazy DFA
     return info;
 }
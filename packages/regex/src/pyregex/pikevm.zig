@@ -270,7 +270,7 @@ pub const PikeVM = struct {
         var has_epsilon = false;
         for (state.transitions) |trans| {
             switch (trans) {
-                .epsilon, .split, .start_assert, .end_assert, .word_boundary, .not_word_boundary => {
+                .epsilon, .split, .start_assert, .end_assert, .word_boundary, .not_word_boundary, .save => {
                     has_epsilon = true;
                     break;
                 },
@@ -327,6 +327,21 @@ pub const PikeVM = struct {
                             try self.addThread(list, new_thread, text, pos);
                         }
                     },
+                    .save => |s| {
+                        // Record group boundary in this thread's slots
+                        var new_thread = thread.clone();
+                        new_thread.state = s.target;
+                        const group = s.slot / 2;
+                        if (group < MAX_CAPTURES) {
+                            if (s.slot % 2 == 0) {
+                                new_thread.captures[group].start = pos;
+                                new_thread.captures[group].end = pos;
+                            } else {
+                                new_thread.captures[group].end = pos;
+                            }
+                        }
+                        try self.addThread(list, new_thread, text, pos);
+                    },
                     else => {},
                 }
             }
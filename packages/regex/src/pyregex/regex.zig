@@ -3,10 +3,16 @@ const std = @import("std");
 const parser = @import("parser.zig");
 const nfa_mod = @import("nfa.zig");
 const pikevm = @import("pikevm.zig");
+const backtrack = @import("backtrack.zig");
 
 pub const Match = pikevm.Match;
 pub const Span = pikevm.Span;
 
+// Multi-pattern front end: one Aho-Corasick pass over the text yields
+// candidates for a whole list of patterns at once
+pub const MultiRegex = @import("multi.zig").MultiRegex;
+pub const MultiMatch = @import("multi.zig").MultiMatch;
+
 /// Compiled regular expression
 pub const Regex = struct {
     nfa: nfa_mod.NFA,
@@ -33,21 +39,32 @@ pub const Regex = struct {
         self.nfa.deinit();
     }
 
+    /// Engine selection: the bounded backtracker resolves captures in
+    /// place (no per-thread span cloning) when states x text fits its
+    /// visited-bit budget; bigger products run on the PikeVM, which
+    /// stays O(n x m) regardless of pattern shape
+    fn searchFrom(self: *Regex, text: []const u8, from: usize) !?Match {
+        if (backtrack.BoundedBacktracker.suitable(&self.nfa, text.len)) {
+            var bt = backtrack.BoundedBacktracker.init(self.allocator, &self.nfa);
+            return try bt.findFrom(text, from);
+        }
+        var vm = pikevm.PikeVM.init(self.allocator, &self.nfa);
+        return try vm.findFrom(text, from);
+    }
+
     /// Find first match in text
     pub fn find(self: *Regex, text: []const u8) !?Match {
-        var vm = pikevm.PikeVM.init(self.allocator, &self.nfa);
-        return try vm.find(text);
+        return try self.searchFrom(text, 0);
     }
 
     /// Find all non-overlapping matches in text (zero-copy - returns spans)
     /// Use this when you only need positions, not copied strings
     pub fn findAllSpans(self: *Regex, text: []const u8) !std.ArrayList(Span) {
         var results = std.ArrayList(Span){};
-        var vm = pikevm.PikeVM.init(self.allocator, &self.nfa);
 
         var pos: usize = 0;
         while (pos < text.len) {
-            const maybe_match = try vm.findFrom(text, pos);
+            const maybe_match = try self.searchFrom(text, pos);
             if (maybe_match) |m| {
                 var match = m;
                 defer match.deinit(self.allocator);
@@ -73,12 +90,11 @@ pub const Regex = struct {
     /// Use findAllSpans for zero-copy version
     pub fn findAll(self: *Regex, text: []const u8) !std.ArrayList([]const u8) {
         var results = std.ArrayList([]const u8){};
-        var vm = pikevm.PikeVM.init(self.allocator, &self.nfa);
 
         var pos: usize = 0;
         while (pos < text.len) {
             // Search for match starting at or after pos
-            const maybe_match = try vm.findFrom(text, pos);
+            const maybe_match = try self.searchFrom(text, pos);
             if (maybe_match) |m| {
                 var match = m;
                 defer match.deinit(self.allocator);
@@ -162,6 +178,24 @@ test "regex star quantifier" {
     try std.testing.expectEqual(@as(usize, 3), match.span.end);
 }
 
+test "regex capture group" {
+    const allocator = std.testing.allocator;
+
+    var regex = try Regex.compile(allocator, "(cat|dog)s?");
+    defer regex.deinit();
+
+    const result = try regex.find("two dogs");
+    try std.testing.expect(result != null);
+
+    var match = result.?;
+    defer match.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 4), match.span.start);
+    try std.testing.expectEqual(@as(usize, 8), match.span.end);
+    // Group 1 holds just "dog", without the plural suffix
+    try std.testing.expectEqual(@as(usize, 4), match.captures[1].start);
+    try std.testing.expectEqual(@as(usize, 7), match.captures[1].end);
+}
+
 test "regex no match" {
     const allocator = std.testing.allocator;
 
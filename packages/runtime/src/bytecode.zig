@@ -345,3 +345,250 @@ pub const VM = struct {
         try self.stack.append(self.allocator, result);
     }
 };
+
+// =============================================================================
+// Register VM
+// =============================================================================
+// The stack VM above boxes a PyObject for every intermediate value. Hot
+// eval'd expressions run instead on a register machine with unboxed i64
+// registers: the stack program is translated once (each virtual stack slot
+// becomes a register), the dispatch loop does plain integer arithmetic, and
+// only the final result is boxed. Programs the translator cannot handle
+// (string constants, calls) fall back to the stack VM.
+
+/// Register machine opcodes. dst/a/b are register indices; LoadConst packs
+/// a u16 constant-pool index into a/b.
+pub const RegOpCode = enum(u8) {
+    LoadConst,
+    Add,
+    Sub,
+    Mult,
+    Div,
+    FloorDiv,
+    Mod,
+    Pow,
+    Eq,
+    NotEq,
+    Lt,
+    Gt,
+    LtE,
+    GtE,
+    /// Box register a as PyInt and return
+    Return,
+    /// Box register a as PyBool and return
+    ReturnBool,
+};
+
+/// Fixed 4-byte instruction
+pub const RegInstruction = struct {
+    op: RegOpCode,
+    dst: u8 = 0,
+    a: u8 = 0,
+    b: u8 = 0,
+
+    inline fn constIndex(self: RegInstruction) u16 {
+        return @as(u16, self.a) | (@as(u16, self.b) << 8);
+    }
+};
+
+/// Register program translated from a stack BytecodeProgram. Borrows the
+/// source program's constant pool - keep the stack program alive (the eval
+/// cache does) while this runs.
+pub const RegisterProgram = struct {
+    instructions: []RegInstruction,
+    constants: []const Constant,
+    num_regs: u16,
+    allocator: std.mem.Allocator,
+
+    pub fn deinit(self: *RegisterProgram) void {
+        self.allocator.free(self.instructions);
+    }
+
+    /// Translate a stack program: each virtual stack slot maps to a
+    /// register, binary ops write their result back into the left operand's
+    /// register. Returns error.NotImplemented for programs with opcodes or
+    /// constants the register machine does not cover.
+    pub fn fromStack(allocator: std.mem.Allocator, program: *const BytecodeProgram) !RegisterProgram {
+        var instructions = std.ArrayList(RegInstruction){};
+        errdefer instructions.deinit(allocator);
+
+        // Virtual stack: which register holds each slot, and whether the
+        // value is boolean (so Return can box it as PyBool)
+        var stack_regs: [256]u8 = undefined;
+        var stack_bool: [256]bool = undefined;
+        var depth: usize = 0;
+        var max_regs: u16 = 0;
+
+        for (program.instructions) |inst| {
+            switch (inst.op) {
+                .LoadConst => {
+                    if (inst.arg >= program.constants.len) return error.InvalidBytecode;
+                    if (program.constants[inst.arg] != .int) return error.NotImplemented;
+                    if (depth >= stack_regs.len) return error.StackOverflow;
+                    const dst: u8 = @intCast(depth);
+                    stack_regs[depth] = dst;
+                    stack_bool[depth] = false;
+                    depth += 1;
+                    if (depth > max_regs) max_regs = @intCast(depth);
+                    try instructions.append(allocator, .{
+                        .op = .LoadConst,
+                        .dst = dst,
+                        .a = @truncate(inst.arg),
+                        .b = @truncate(inst.arg >> 8),
+                    });
+                },
+                .Add, .Sub, .Mult, .Div, .FloorDiv, .Mod, .Pow, .Eq, .NotEq, .Lt, .Gt, .LtE, .GtE => {
+                    if (depth < 2) return error.StackUnderflow;
+                    const b = stack_regs[depth - 1];
+                    const a = stack_regs[depth - 2];
+                    depth -= 1;
+                    const is_compare = switch (inst.op) {
+                        .Eq, .NotEq, .Lt, .Gt, .LtE, .GtE => true,
+                        else => false,
+                    };
+                    stack_bool[depth - 1] = is_compare;
+                    const op: RegOpCode = switch (inst.op) {
+                        .Add => .Add,
+                        .Sub => .Sub,
+                        .Mult => .Mult,
+                        .Div => .Div,
+                        .FloorDiv => .FloorDiv,
+                        .Mod => .Mod,
+                        .Pow => .Pow,
+                        .Eq => .Eq,
+                        .NotEq => .NotEq,
+                        .Lt => .Lt,
+                        .Gt => .Gt,
+                        .LtE => .LtE,
+                        .GtE => .GtE,
+                        else => unreachable,
+                    };
+                    try instructions.append(allocator, .{ .op = op, .dst = a, .a = a, .b = b });
+                },
+                .Return => {
+                    if (depth == 0) return error.EmptyStack;
+                    const src = stack_regs[depth - 1];
+                    const op: RegOpCode = if (stack_bool[depth - 1]) .ReturnBool else .Return;
+                    try instructions.append(allocator, .{ .op = op, .a = src });
+                },
+                else => return error.NotImplemented,
+            }
+        }
+
+        return .{
+            .instructions = try instructions.toOwnedSlice(allocator),
+            .constants = program.constants,
+            .num_regs = max_regs,
+            .allocator = allocator,
+        };
+    }
+};
+
+/// Register VM - dispatch loop over unboxed i64 registers
+pub const RegVM = struct {
+    allocator: std.mem.Allocator,
+
+    pub fn init(allocator: std.mem.Allocator) RegVM {
+        return .{ .allocator = allocator };
+    }
+
+    pub fn execute(self: *RegVM, program: *const RegisterProgram) !*PyObject {
+        var regs_buf: [256]i64 = undefined;
+        const regs = regs_buf[0..program.num_regs];
+
+        for (program.instructions) |inst| {
+            switch (inst.op) {
+                .LoadConst => regs[inst.dst] = program.constants[inst.constIndex()].int,
+                .Add => regs[inst.dst] = regs[inst.a] +% regs[inst.b],
+                .Sub => regs[inst.dst] = regs[inst.a] -% regs[inst.b],
+                .Mult => regs[inst.dst] = regs[inst.a] *% regs[inst.b],
+                .Div => {
+                    if (regs[inst.b] == 0) return error.DivisionByZero;
+                    regs[inst.dst] = @divTrunc(regs[inst.a], regs[inst.b]);
+                },
+                .FloorDiv => {
+                    if (regs[inst.b] == 0) return error.DivisionByZero;
+                    regs[inst.dst] = @divFloor(regs[inst.a], regs[inst.b]);
+                },
+                .Mod => {
+                    if (regs[inst.b] == 0) return error.DivisionByZero;
+                    regs[inst.dst] = @mod(regs[inst.a], regs[inst.b]);
+                },
+                .Pow => {
+                    if (regs[inst.b] < 0) return error.NotImplemented;
+                    regs[inst.dst] = std.math.pow(i64, regs[inst.a], regs[inst.b]);
+                },
+                .Eq => regs[inst.dst] = @intFromBool(regs[inst.a] == regs[inst.b]),
+                .NotEq => regs[inst.dst] = @intFromBool(regs[inst.a] != regs[inst.b]),
+                .Lt => regs[inst.dst] = @intFromBool(regs[inst.a] < regs[inst.b]),
+                .Gt => regs[inst.dst] = @intFromBool(regs[inst.a] > regs[inst.b]),
+                .LtE => regs[inst.dst] = @intFromBool(regs[inst.a] <= regs[inst.b]),
+                .GtE => regs[inst.dst] = @intFromBool(regs[inst.a] >= regs[inst.b]),
+                .Return => return try PyInt.create(self.allocator, regs[inst.a]),
+                .ReturnBool => return try PyBool.create(self.allocator, regs[inst.a] != 0),
+            }
+        }
+
+        return error.NoReturnValue;
+    }
+};
+
+test "register VM matches stack VM" {
+    const allocator = std.testing.allocator;
+    const expr_parser = @import("expr_parser.zig");
+
+    const cases = [_]struct { src: []const u8, expected: i64 }{
+        .{ .src = "1 + 2 * 3", .expected = 7 },
+        .{ .src = "(10 - 4) // 4", .expected = 1 },
+        .{ .src = "2 ** 10 % 7", .expected = 2 },
+        .{ .src = "-5 + 3", .expected = -2 },
+    };
+
+    for (cases) |case| {
+        var program = try expr_parser.parseExpression(allocator, case.src);
+        defer program.deinit();
+
+        var reg_program = try RegisterProgram.fromStack(allocator, &program);
+        defer reg_program.deinit();
+
+        var vm = RegVM.init(allocator);
+        const result = try vm.execute(&reg_program);
+        defer @import("runtime.zig").decref(result, allocator);
+        try std.testing.expectEqual(case.expected, PyInt.getValue(result));
+    }
+}
+
+test "register VM boxes comparison results as bool" {
+    const allocator = std.testing.allocator;
+    const expr_parser = @import("expr_parser.zig");
+    const runtime = @import("runtime.zig");
+
+    var program = try expr_parser.parseExpression(allocator, "2 + 2 == 4");
+    defer program.deinit();
+
+    var reg_program = try RegisterProgram.fromStack(allocator, &program);
+    defer reg_program.deinit();
+
+    var vm = RegVM.init(allocator);
+    const result = try vm.execute(&reg_program);
+    defer runtime.decref(result, allocator);
+    try std.testing.expect(runtime.PyBool_Check(result));
+    try std.testing.expect(PyBool.getValue(result));
+}
+
+test "register VM translation rejects unsupported programs" {
+    const allocator = std.testing.allocator;
+
+    // String constants stay on the stack VM
+    var constants = [_]Constant{.{ .string = "hello" }};
+    var instructions = [_]Instruction{
+        .{ .op = .LoadConst, .arg = 0 },
+        .{ .op = .Return },
+    };
+    const program = BytecodeProgram{
+        .instructions = &instructions,
+        .constants = &constants,
+        .allocator = allocator,
+    };
+    try std.testing.expectError(error.NotImplemented, RegisterProgram.fromStack(allocator, &program));
+}
@@ -2,41 +2,10 @@
 /// Comptime target selection: WASM vs Native
 const std = @import("std");
 const builtin = @import("builtin");
-const ast_executor = @import("ast_executor.zig");
 const bytecode = @import("bytecode.zig");
 const PyObject = @import("runtime.zig").PyObject;
 const hashmap_helper = @import("hashmap_helper");
 
-/// Compile Python source via metal0 subprocess (for dynamic eval)
-/// Spawns: metal0 --emit-bytecode <source>
-/// Returns parsed BytecodeProgram from subprocess stdout
-pub fn compileViaSubprocess(allocator: std.mem.Allocator, source: []const u8) !bytecode.BytecodeProgram {
-    // Build argv: ["metal0", "--emit-bytecode", source]
-    const argv = [_][]const u8{ "metal0", "--emit-bytecode", source };
-
-    // Spawn subprocess
-    var child = std.process.Child.init(&argv, allocator);
-    child.stdout_behavior = .Pipe;
-    child.stderr_behavior = .Pipe;
-
-    try child.spawn();
-
-    // Read stdout (bytecode binary)
-    const stdout = child.stdout orelse return error.NoStdout;
-    const bytecode_data = try stdout.readToEndAlloc(allocator, 1024 * 1024); // 1MB max
-    defer allocator.free(bytecode_data);
-
-    // Wait for child
-    const term = try child.wait();
-    switch (term) {
-        .Exited => |code| if (code != 0) return error.SubprocessFailed,
-        else => return error.SubprocessFailed,
-    }
-
-    // Parse bytecode
-    return bytecode.BytecodeProgram.deserialize(allocator, bytecode_data);
-}
-
 /// LRU cache configuration
 pub const CacheConfig = struct {
     max_entries: usize = 1024,
@@ -200,62 +169,78 @@ pub const LruCache = struct {
     }
 };
 
-/// Global LRU cache - thread-safe wrapper
-var lru_cache: ?LruCache = null;
-var cache_mutex: std.Thread.Mutex = .{};
+/// Global cache, sharded by source hash. Each shard has its own mutex and
+/// LRU list, so concurrent green threads evaluating different sources don't
+/// serialize on one global lock. Must be a power of two.
+const SHARD_COUNT = 8;
+
+const CacheShard = struct {
+    mutex: std.Thread.Mutex = .{},
+    cache: ?LruCache = null,
+};
+
+var shards: [SHARD_COUNT]CacheShard = [_]CacheShard{.{}} ** SHARD_COUNT;
 var cache_allocator: ?std.mem.Allocator = null;
 
+fn shardFor(source: []const u8) *CacheShard {
+    const h = std.hash.Wyhash.hash(0, source);
+    return &shards[h & (SHARD_COUNT - 1)];
+}
+
 /// Initialize eval cache (call once at startup)
+/// The global entry/memory budget is split evenly across shards.
 pub fn initCache(allocator: std.mem.Allocator) !void {
-    cache_mutex.lock();
-    defer cache_mutex.unlock();
+    const defaults = CacheConfig{};
+    const shard_config = CacheConfig{
+        .max_entries = defaults.max_entries / SHARD_COUNT,
+        .max_memory_bytes = defaults.max_memory_bytes / SHARD_COUNT,
+    };
 
-    if (lru_cache == null) {
-        cache_allocator = allocator;
-        lru_cache = LruCache.init(allocator, .{});
+    for (&shards) |*shard| {
+        shard.mutex.lock();
+        defer shard.mutex.unlock();
+        if (shard.cache == null) {
+            shard.cache = LruCache.init(allocator, shard_config);
+        }
     }
+    cache_allocator = allocator;
 }
 
-/// Cached eval() - compiles once, executes many times
+/// Cached eval() - compiles once in-process, executes many times
 pub fn evalCached(allocator: std.mem.Allocator, source: []const u8) !*PyObject {
     // Ensure cache is initialized
-    if (lru_cache == null) {
+    if (cache_allocator == null) {
         try initCache(allocator);
     }
 
-    // Check cache first (thread-safe)
-    cache_mutex.lock();
-    const cached = if (lru_cache) |*cache| cache.get(source) else null;
-    cache_mutex.unlock();
+    const shard = shardFor(source);
+
+    // Check this source's shard (other shards stay unlocked)
+    shard.mutex.lock();
+    const cached = if (shard.cache) |*cache| cache.get(source) else null;
+    shard.mutex.unlock();
 
     if (cached) |program| {
         // Cache hit - execute bytecode
         return executeTarget(allocator, program);
     }
 
-    // Cache miss - parse expression directly to bytecode
-    // Uses lightweight runtime parser (Zig DCE removes if eval() never called)
-    const program = parseSourceToBytecode(source, allocator) catch |err| {
-        // Fallback: compile via metal0 subprocess for complex statements
-        if (err == error.UnexpectedToken or err == error.OutOfMemory) {
-            const fallback_program = compileViaSubprocess(allocator, source) catch return err;
-            // Execute the fallback program
-            return executeTarget(allocator, &fallback_program);
-        }
-        return err;
-    };
+    // Cache miss - compile in-process with the runtime expression parser.
+    // No subprocess: the parser is linked into the runtime (and DCE'd away
+    // if eval() is never called), so a miss costs a parse, not a fork.
+    const program = try parseSourceToBytecode(source, allocator);
 
     // Store in cache (thread-safe, LRU handles eviction)
-    cache_mutex.lock();
-    if (lru_cache) |*cache| {
+    shard.mutex.lock();
+    if (shard.cache) |*cache| {
         try cache.put(source, program);
     }
-    cache_mutex.unlock();
+    shard.mutex.unlock();
 
     // Get the cached program to return (since put may have stored a copy)
-    cache_mutex.lock();
-    const stored = if (lru_cache) |*cache| cache.get(source) else null;
-    cache_mutex.unlock();
+    shard.mutex.lock();
+    const stored = if (shard.cache) |*cache| cache.get(source) else null;
+    shard.mutex.unlock();
 
     if (stored) |p| {
         return executeTarget(allocator, p);
@@ -282,11 +267,18 @@ fn executeWasm(allocator: std.mem.Allocator, program: *const bytecode.BytecodePr
     return vm.execute(program);
 }
 
-/// Native bytecode execution (same as WASM for now)
+/// Native bytecode execution - register VM with unboxed registers. Programs
+/// the register translator rejects (strings, calls) run on the stack VM.
 fn executeNative(allocator: std.mem.Allocator, program: *const bytecode.BytecodeProgram) !*PyObject {
-    var vm = bytecode.VM.init(allocator);
-    defer vm.deinit();
-    return vm.execute(program);
+    var reg_program = bytecode.RegisterProgram.fromStack(allocator, program) catch {
+        var vm = bytecode.VM.init(allocator);
+        defer vm.deinit();
+        return vm.execute(program);
+    };
+    defer reg_program.deinit();
+
+    var vm = bytecode.RegVM.init(allocator);
+    return vm.execute(&reg_program);
 }
 
 /// Parse source code directly to bytecode using runtime expression parser
@@ -298,34 +290,42 @@ fn parseSourceToBytecode(source: []const u8, allocator: std.mem.Allocator) !byte
 
 /// Clear eval cache (for testing)
 pub fn clearCache() void {
-    cache_mutex.lock();
-    defer cache_mutex.unlock();
-
-    if (lru_cache) |*cache| {
-        cache.deinit();
-        lru_cache = null;
+    for (&shards) |*shard| {
+        shard.mutex.lock();
+        defer shard.mutex.unlock();
+        if (shard.cache) |*cache| {
+            cache.deinit();
+            shard.cache = null;
+        }
     }
 }
 
-/// Get cache statistics (thread-safe)
+/// Get cache statistics aggregated across shards (thread-safe)
 pub fn getCacheStats() ?struct { entries: usize, memory: usize, max_entries: usize, max_memory: usize } {
-    cache_mutex.lock();
-    defer cache_mutex.unlock();
+    if (cache_allocator == null) return null;
 
-    if (lru_cache) |*cache| {
-        return cache.getStats();
+    var totals: struct { entries: usize, memory: usize, max_entries: usize, max_memory: usize } = .{
+        .entries = 0,
+        .memory = 0,
+        .max_entries = 0,
+        .max_memory = 0,
+    };
+    for (&shards) |*shard| {
+        shard.mutex.lock();
+        defer shard.mutex.unlock();
+        if (shard.cache) |*cache| {
+            const stats = cache.getStats();
+            totals.entries += stats.entries;
+            totals.memory += stats.memory;
+            totals.max_entries += stats.max_entries;
+            totals.max_memory += stats.max_memory;
+        }
     }
-    return null;
+    return totals;
 }
 
 /// Deinitialize cache completely (call at shutdown)
 pub fn deinitCache() void {
-    cache_mutex.lock();
-    defer cache_mutex.unlock();
-
-    if (lru_cache) |*cache| {
-        cache.deinit();
-        lru_cache = null;
-        cache_allocator = null;
-    }
+    clearCache();
+    cache_allocator = null;
 }
@@ -1,5 +1,98 @@
 const std = @import("std");
 
+/// Pool of green thread stacks with free-list reuse.
+///
+/// Each stack is one mmap reservation: a guard page at the low end
+/// catches overflow, and the rest is mapped read/write but only backed
+/// by physical pages on first touch - so a mostly-idle thread costs a
+/// large virtual range but a few KB of RAM. Released stacks keep their
+/// reservation on an intrusive free list (the node lives in the stack
+/// memory itself) with their committed pages returned to the OS, so a
+/// later spawn is a mutex-guarded pointer pop instead of an mmap.
+pub const StackPool = struct {
+    mutex: std.Thread.Mutex = .{},
+    free_list: ?*FreeNode = null,
+    free_count: usize = 0,
+
+    /// Virtual reservation per stack (usable size is this minus guard)
+    pub const RESERVE_SIZE = 256 * 1024;
+    const GUARD_SIZE = std.heap.page_size_min;
+    /// Reservations kept for reuse before release falls back to munmap
+    const MAX_FREE = 1024;
+
+    /// Free-list node, stored at the low end of the released stack
+    const FreeNode = struct {
+        next: ?*FreeNode,
+    };
+
+    /// Pop a pooled stack, or map a fresh reservation
+    pub fn acquire(self: *StackPool) ![]align(16) u8 {
+        self.mutex.lock();
+        if (self.free_list) |node| {
+            self.free_list = node.next;
+            self.free_count -= 1;
+            self.mutex.unlock();
+            const ptr: [*]align(16) u8 = @ptrCast(@alignCast(node));
+            return ptr[0 .. RESERVE_SIZE - GUARD_SIZE];
+        }
+        self.mutex.unlock();
+
+        const mapping = try std.posix.mmap(
+            null,
+            RESERVE_SIZE,
+            std.posix.PROT.READ | std.posix.PROT.WRITE,
+            .{ .TYPE = .PRIVATE, .ANONYMOUS = true },
+            -1,
+            0,
+        );
+        // Guard page below the stack (stacks grow downward)
+        try std.posix.mprotect(mapping[0..GUARD_SIZE], std.posix.PROT.NONE);
+        return @alignCast(mapping[GUARD_SIZE..]);
+    }
+
+    /// Return a stack for reuse (or unmap it when the pool is full).
+    /// Committed pages above the free-list node go back to the OS so a
+    /// pooled stack shrinks to its lazy footprint again.
+    pub fn release(self: *StackPool, stack: []align(16) u8) void {
+        self.mutex.lock();
+        if (self.free_count >= MAX_FREE) {
+            self.mutex.unlock();
+            unmapStack(stack);
+            return;
+        }
+
+        // Drop physical pages, keeping the first (it holds the node)
+        if (stack.len > std.heap.page_size_min) {
+            const drop = stack[std.heap.page_size_min..];
+            std.posix.madvise(@alignCast(drop.ptr), drop.len, std.posix.MADV.DONTNEED) catch {};
+        }
+
+        const node: *FreeNode = @ptrCast(@alignCast(stack.ptr));
+        node.* = .{ .next = self.free_list };
+        self.free_list = node;
+        self.free_count += 1;
+        self.mutex.unlock();
+    }
+
+    /// Unmap all pooled reservations
+    pub fn deinit(self: *StackPool) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        while (self.free_list) |node| {
+            self.free_list = node.next;
+            const ptr: [*]align(16) u8 = @ptrCast(@alignCast(node));
+            unmapStack(ptr[0 .. RESERVE_SIZE - GUARD_SIZE]);
+        }
+        self.free_count = 0;
+    }
+
+    fn unmapStack(stack: []align(16) u8) void {
+        const base_addr = @intFromPtr(stack.ptr) - GUARD_SIZE;
+        const base: [*]align(std.heap.page_size_min) u8 = @ptrFromInt(base_addr);
+        std.posix.munmap(base[0..RESERVE_SIZE]);
+    }
+};
+
 pub const GreenThread = struct {
     id: u64,
     stack: []align(16) u8,
@@ -9,6 +102,7 @@ pub const GreenThread = struct {
     user_context: ?*anyopaque,
     func_ptr: *const fn (?*anyopaque) void,
     context_cleanup: ?*const fn (*GreenThread, std.mem.Allocator) void, // Optional cleanup for user_context
+    stack_pool: ?*StackPool = null, // Set when the stack came from a pool
 
     pub const State = enum {
         ready,
@@ -62,8 +156,45 @@ pub const GreenThread = struct {
         return thread;
     }
 
+    /// Like init(), but the stack comes from (and returns to) a pool
+    pub fn initPooled(
+        allocator: std.mem.Allocator,
+        pool: *StackPool,
+        id: u64,
+        func: *const fn (?*anyopaque) void,
+        user_ctx: ?*anyopaque,
+        cleanup: ?*const fn (*GreenThread, std.mem.Allocator) void,
+    ) !*GreenThread {
+        const thread = try allocator.create(GreenThread);
+        errdefer allocator.destroy(thread);
+
+        const stack = try pool.acquire();
+        errdefer pool.release(stack);
+
+        thread.* = GreenThread{
+            .id = id,
+            .stack = stack,
+            .state = .ready,
+            .result = null,
+            .cpu_context = .{},
+            .user_context = user_ctx,
+            .func_ptr = func,
+            .context_cleanup = cleanup,
+            .stack_pool = pool,
+        };
+
+        thread.cpu_context.rsp = @intFromPtr(stack.ptr) + stack.len - 16;
+        thread.cpu_context.rbp = thread.cpu_context.rsp;
+
+        return thread;
+    }
+
     pub fn deinit(self: *GreenThread, allocator: std.mem.Allocator) void {
-        allocator.free(self.stack);
+        if (self.stack_pool) |pool| {
+            pool.release(self.stack);
+        } else {
+            allocator.free(self.stack);
+        }
         allocator.destroy(self);
     }
 
@@ -86,6 +217,44 @@ pub const GreenThread = struct {
     }
 };
 
+test "StackPool reuses released stacks" {
+    var pool = StackPool{};
+    defer pool.deinit();
+
+    const first = try pool.acquire();
+    try std.testing.expectEqual(
+        @as(usize, StackPool.RESERVE_SIZE - std.heap.page_size_min),
+        first.len,
+    );
+    const first_ptr = first.ptr;
+    pool.release(first);
+
+    // Same reservation comes back instead of a fresh mmap
+    const second = try pool.acquire();
+    defer pool.release(second);
+    try std.testing.expectEqual(first_ptr, second.ptr);
+}
+
+test "GreenThread pooled creation" {
+    const allocator = std.testing.allocator;
+
+    var pool = StackPool{};
+    defer pool.deinit();
+
+    const TestFunc = struct {
+        fn func(ctx: ?*anyopaque) void {
+            _ = ctx;
+        }
+    };
+
+    const thread = try GreenThread.initPooled(allocator, &pool, 7, TestFunc.func, null, null);
+    try std.testing.expectEqual(@as(u64, 7), thread.id);
+    thread.deinit(allocator);
+
+    // Stack went back to the pool on deinit
+    try std.testing.expectEqual(@as(usize, 1), pool.free_count);
+}
+
 test "GreenThread basic creation" {
     const allocator = std.testing.allocator;
 
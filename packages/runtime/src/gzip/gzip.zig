@@ -1,101 +1,241 @@
 // metal0 gzip module implementation
 // Implements Python's gzip.compress() and gzip.decompress() functions
-// Uses zlib C library for gzip compression
+//
+// Fast path: libdeflate's whole-buffer API (vendor/libdeflate), which is
+// 2-3x faster than streaming zlib inflate on typical payloads.
+// Fallback: std.compress.flate streaming inflate for deflate streams that
+// libdeflate rejects.
+//
+// Header and trailer are handled here rather than by libdeflate's gzip
+// wrapper so that corruption maps to the specific Python-style errors
+// (BadGzipHeader, WrongGzipChecksum, WrongGzipSize) instead of a generic
+// bad-data result, and so that multi-member streams are supported.
 
 const std = @import("std");
 const Allocator = std.mem.Allocator;
 
-const c = @cImport({
-    @cInclude("zlib.h");
-});
+const libdeflate = @import("libdeflate.zig");
+const c = libdeflate.c;
 
-// Gzip header adds 10 bytes + 8 bytes trailer = 18 bytes overhead
+// Gzip framing (RFC 1952): 10-byte header + 8-byte trailer per member
 const GZIP_HEADER_SIZE = 10;
 const GZIP_TRAILER_SIZE = 8;
 
+// FLG bits
+const FHCRC: u8 = 1 << 1;
+const FEXTRA: u8 = 1 << 2;
+const FNAME: u8 = 1 << 3;
+const FCOMMENT: u8 = 1 << 4;
+const FRESERVED: u8 = 0xe0;
+
+/// Matches zlib's Z_DEFAULT_COMPRESSION behavior
+const DEFAULT_LEVEL = 6;
+
+/// Deflate cannot expand beyond ~1032x; used to sanity-check the ISIZE
+/// trailer field before trusting it as an allocation hint
+const MAX_EXPANSION = 1032;
+
+/// Hard cap on decompressed output (mirrors c_interop/zlib.zig)
+const MAX_OUTPUT = 256 * 1024 * 1024;
+
 /// Compress data using gzip format
 /// Caller owns returned memory and must free it with allocator.free()
 pub fn compress(allocator: Allocator, data: []const u8) ![]u8 {
-    // Use deflateInit2 with gzip format (windowBits + 16)
-    var stream: c.z_stream = std.mem.zeroes(c.z_stream);
-
-    // windowBits = 15 + 16 = 31 for gzip format
-    const rc_init = c.deflateInit2(
-        &stream,
-        c.Z_DEFAULT_COMPRESSION,
-        c.Z_DEFLATED,
-        15 + 16, // gzip format
-        8,       // memLevel
-        c.Z_DEFAULT_STRATEGY,
-    );
-    if (rc_init != c.Z_OK) {
-        return error.InitFailed;
-    }
-    defer _ = c.deflateEnd(&stream);
+    const compressor = c.libdeflate_alloc_compressor(DEFAULT_LEVEL) orelse return error.OutOfMemory;
+    defer c.libdeflate_free_compressor(compressor);
 
-    // Allocate output buffer
-    const bound = c.deflateBound(&stream, @intCast(data.len));
-    var output = try allocator.alloc(u8, bound);
+    // Whole-buffer compress: bound-sized output cannot run out of space
+    const bound = c.libdeflate_gzip_compress_bound(compressor, data.len);
+    const output = try allocator.alloc(u8, bound);
     errdefer allocator.free(output);
 
-    stream.next_in = @constCast(data.ptr);
-    stream.avail_in = @intCast(data.len);
-    stream.next_out = output.ptr;
-    stream.avail_out = @intCast(bound);
-
-    const rc = c.deflate(&stream, c.Z_FINISH);
-    if (rc != c.Z_STREAM_END) {
+    const compressed_size = c.libdeflate_gzip_compress(
+        compressor,
+        data.ptr,
+        data.len,
+        output.ptr,
+        output.len,
+    );
+    if (compressed_size == 0) {
         return error.CompressFailed;
     }
 
-    const output_size = bound - stream.avail_out;
-    return allocator.realloc(output, output_size) catch output[0..output_size];
+    return allocator.realloc(output, compressed_size) catch output[0..compressed_size];
 }
 
-/// Decompress gzip-compressed data
+/// Decompress gzip-compressed data (handles multi-member streams)
 /// Caller owns returned memory and must free it with allocator.free()
 pub fn decompress(allocator: Allocator, data: []const u8) ![]u8 {
-    // Use inflateInit2 with gzip format (windowBits + 16)
-    var stream: c.z_stream = std.mem.zeroes(c.z_stream);
+    if (data.len == 0) return error.EndOfStream;
+
+    const decompressor = c.libdeflate_alloc_decompressor() orelse return error.OutOfMemory;
+    defer c.libdeflate_free_decompressor(decompressor);
+
+    var joined = std.ArrayList(u8){};
+    errdefer joined.deinit(allocator);
+
+    var offset: usize = 0;
+    while (offset < data.len) {
+        const member = try decompressMember(allocator, decompressor, data, offset);
+        offset = member.next_offset;
+
+        // Common case: exactly one member - return its buffer without copying
+        if (joined.items.len == 0 and offset == data.len) {
+            return member.data;
+        }
 
-    // windowBits = 15 + 16 = 31 for gzip format (or 15 + 32 for auto-detect)
-    const rc_init = c.inflateInit2(&stream, 15 + 32); // auto-detect gzip/deflate
-    if (rc_init != c.Z_OK) {
-        return error.InitFailed;
+        defer allocator.free(member.data);
+        try joined.appendSlice(allocator, member.data);
     }
-    defer _ = c.inflateEnd(&stream);
 
-    // Start with estimated output size
-    var output_size: usize = data.len * 4;
-    if (output_size < 1024) output_size = 1024;
+    return joined.toOwnedSlice(allocator);
+}
 
-    var output = try allocator.alloc(u8, output_size);
-    errdefer allocator.free(output);
+const Member = struct {
+    data: []u8,
+    next_offset: usize,
+};
+
+const Inflated = struct {
+    data: []u8,
+    consumed: usize,
+};
+
+/// Decompress one gzip member starting at `offset` and verify its trailer
+fn decompressMember(
+    allocator: Allocator,
+    decompressor: *c.struct_libdeflate_decompressor,
+    data: []const u8,
+    offset: usize,
+) !Member {
+    const payload_start = try parseHeader(data, offset);
+
+    const inflated = inflateLibdeflate(allocator, decompressor, data, payload_start) catch |err| switch (err) {
+        // libdeflate rejected the stream - retry with the generic inflate
+        error.DecompressFailed => try inflateStreamingFinal(allocator, data, payload_start),
+        else => return err,
+    };
+    errdefer allocator.free(inflated.data);
+
+    // Verify the 8-byte trailer: CRC32 then ISIZE (mod 2^32), little-endian
+    const trailer_off = payload_start + inflated.consumed;
+    if (trailer_off + GZIP_TRAILER_SIZE > data.len) return error.EndOfStream;
 
-    stream.next_in = @constCast(data.ptr);
-    stream.avail_in = @intCast(data.len);
-    stream.next_out = output.ptr;
-    stream.avail_out = @intCast(output_size);
+    const expected_crc = std.mem.readInt(u32, data[trailer_off..][0..4], .little);
+    const expected_size = std.mem.readInt(u32, data[trailer_off + 4 ..][0..4], .little);
+
+    const actual_crc: u32 = @truncate(c.libdeflate_crc32(0, inflated.data.ptr, inflated.data.len));
+    if (actual_crc != expected_crc) return error.WrongGzipChecksum;
+    if (expected_size != @as(u32, @truncate(inflated.data.len))) return error.WrongGzipSize;
+
+    return .{ .data = inflated.data, .next_offset = trailer_off + GZIP_TRAILER_SIZE };
+}
+
+/// Validate one member's header and return the offset of its deflate payload
+fn parseHeader(data: []const u8, offset: usize) !usize {
+    const rest = data[offset..];
+    if (rest.len < 3) return error.EndOfStream;
+    if (rest[0] != 0x1f or rest[1] != 0x8b) return error.BadGzipHeader;
+    if (rest[2] != 0x08) return error.BadGzipHeader; // only deflate (CM=8)
+    if (rest.len < GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE) return error.EndOfStream;
+
+    const flg = rest[3];
+    if (flg & FRESERVED != 0) return error.BadGzipHeader;
+
+    var pos: usize = GZIP_HEADER_SIZE;
+    if (flg & FEXTRA != 0) {
+        if (pos + 2 > rest.len) return error.EndOfStream;
+        const xlen = std.mem.readInt(u16, rest[pos..][0..2], .little);
+        pos += 2 + xlen;
+        if (pos > rest.len) return error.EndOfStream;
+    }
+    if (flg & FNAME != 0) {
+        pos = skipZeroTerminated(rest, pos) orelse return error.EndOfStream;
+    }
+    if (flg & FCOMMENT != 0) {
+        pos = skipZeroTerminated(rest, pos) orelse return error.EndOfStream;
+    }
+    if (flg & FHCRC != 0) {
+        pos += 2;
+        if (pos > rest.len) return error.EndOfStream;
+    }
+    if (pos + GZIP_TRAILER_SIZE > rest.len) return error.EndOfStream;
+    return offset + pos;
+}
+
+fn skipZeroTerminated(buf: []const u8, start: usize) ?usize {
+    const idx = std.mem.indexOfScalarPos(u8, buf, start, 0) orelse return null;
+    return idx + 1;
+}
+
+/// Whole-buffer inflate via libdeflate; grows the output on demand.
+/// `consumed` reports how many input bytes the deflate stream occupied,
+/// which locates the member trailer (and any following members).
+fn inflateLibdeflate(
+    allocator: Allocator,
+    decompressor: *c.struct_libdeflate_decompressor,
+    data: []const u8,
+    payload_start: usize,
+) !Inflated {
+    const stream = data[payload_start..];
+
+    // Output sizing: the final member's ISIZE is an exact hint for
+    // single-member data; ignore it when implausible (corrupt trailer or
+    // multi-member stream) rather than over-allocating
+    var out_size: usize = blk: {
+        const isize_hint = std.mem.readInt(u32, data[data.len - 4 ..][0..4], .little);
+        if (isize_hint > 0 and isize_hint <= stream.len * MAX_EXPANSION + 64) break :blk isize_hint;
+        break :blk @max(stream.len * 4, 1024);
+    };
+
+    var output = try allocator.alloc(u8, out_size);
+    errdefer allocator.free(output);
 
     while (true) {
-        const rc = c.inflate(&stream, c.Z_FINISH);
-
-        if (rc == c.Z_STREAM_END) {
-            const actual_size = output_size - stream.avail_out;
-            return allocator.realloc(output, actual_size) catch output[0..actual_size];
-        } else if (rc == c.Z_BUF_ERROR or (rc == c.Z_OK and stream.avail_out == 0)) {
-            // Need more output space
-            const used = output_size - stream.avail_out;
-            output_size *= 2;
-            output = try allocator.realloc(output, output_size);
-            stream.next_out = output.ptr + used;
-            stream.avail_out = @intCast(output_size - used);
-        } else if (rc != c.Z_OK) {
-            return error.DecompressFailed;
+        var actual_in: usize = 0;
+        var actual_out: usize = 0;
+        const result = c.libdeflate_deflate_decompress_ex(
+            decompressor,
+            stream.ptr,
+            stream.len,
+            output.ptr,
+            output.len,
+            &actual_in,
+            &actual_out,
+        );
+
+        switch (result) {
+            c.LIBDEFLATE_SUCCESS => {
+                const shrunk = allocator.realloc(output, actual_out) catch output[0..actual_out];
+                return .{ .data = shrunk, .consumed = actual_in };
+            },
+            c.LIBDEFLATE_INSUFFICIENT_SPACE => {
+                if (out_size >= MAX_OUTPUT) return error.DecompressFailed;
+                out_size *= 2;
+                output = try allocator.realloc(output, out_size);
+            },
+            else => return error.DecompressFailed,
         }
     }
 }
 
+/// Streaming fallback using std.compress.flate. Only the final member can
+/// take this path: its deflate payload is exactly delimited by the trailer,
+/// so no consumed-byte bookkeeping from the inflater is needed.
+fn inflateStreamingFinal(allocator: Allocator, data: []const u8, payload_start: usize) !Inflated {
+    const stream = data[payload_start .. data.len - GZIP_TRAILER_SIZE];
+
+    var in: std.Io.Reader = .fixed(stream);
+    var window: [std.compress.flate.max_window_len]u8 = undefined;
+    var inflate: std.compress.flate.Decompress = .init(&in, .raw, &window);
+
+    const output = inflate.reader.allocRemaining(allocator, .unlimited) catch |err| switch (err) {
+        error.OutOfMemory => return error.OutOfMemory,
+        else => return error.DecompressFailed,
+    };
+    return .{ .data = output, .consumed = stream.len };
+}
+
 test "gzip compress and decompress" {
     const alloc = std.testing.allocator;
     const data = "hello world hello world hello world";
@@ -121,3 +261,20 @@ test "gzip empty data" {
 
     try std.testing.expectEqualStrings(data, decompressed);
 }
+
+test "gzip multi-member stream" {
+    const alloc = std.testing.allocator;
+
+    const first = try compress(alloc, "first member ");
+    defer alloc.free(first);
+    const second = try compress(alloc, "second member");
+    defer alloc.free(second);
+
+    const combined = try std.mem.concat(alloc, u8, &.{ first, second });
+    defer alloc.free(combined);
+
+    const decompressed = try decompress(alloc, combined);
+    defer alloc.free(decompressed);
+
+    try std.testing.expectEqualStrings("first member second member", decompressed);
+}
@@ -41,6 +41,9 @@ pub const Client = struct {
     pool: ConnectionPool,
     timeout_ms: u64,
     default_headers: hashmap_helper.StringHashMap([]const u8),
+    // Persistent std.http.Client: its internal pool keeps per-host
+    // connections alive, so send() reuses sockets across requests
+    http_client: std.http.Client,
 
     pub fn init(allocator: std.mem.Allocator) Client {
         return .{
@@ -48,10 +51,12 @@ pub const Client = struct {
             .pool = ConnectionPool.init(allocator, 100), // Max 100 connections
             .timeout_ms = 30000, // 30 second default timeout
             .default_headers = hashmap_helper.StringHashMap([]const u8).init(allocator),
+            .http_client = std.http.Client{ .allocator = allocator },
         };
     }
 
     pub fn deinit(self: *Client) void {
+        self.http_client.deinit();
         self.pool.deinit();
         var it = self.default_headers.iterator();
         while (it.next()) |entry| {
@@ -162,11 +167,8 @@ pub const Client = struct {
     fn send(self: *Client, request: *const Request, uri: *const std.Uri) !Response {
         _ = request; // TODO: use custom headers from request
 
-        // Use Zig's built-in HTTP client
-        var client = std.http.Client{ .allocator = self.allocator };
-        defer client.deinit();
-
-        const fetch_result = client.fetch(.{
+        // Reuse the persistent client (keep-alive across requests)
+        const fetch_result = self.http_client.fetch(.{
             .location = .{ .uri = uri.* },
         }) catch |err| {
             std.debug.print("HTTP fetch error: {}\n", .{err});
@@ -182,10 +184,7 @@ pub const Client = struct {
 
     /// Fetch URL and return body as slice (simple API for Python wrappers)
     pub fn fetchBody(self: *Client, url: []const u8) ![]const u8 {
-        var client = std.http.Client{ .allocator = self.allocator };
-        defer client.deinit();
-
-        const result = client.fetch(.{
+        const result = self.http_client.fetch(.{
             .location = .{ .url = url },
         }) catch |err| {
             std.debug.print("HTTP fetch error: {}\n", .{err});
@@ -200,10 +199,7 @@ pub const Client = struct {
 
     /// Fetch URL with POST body and return response body
     pub fn fetchBodyPost(self: *Client, url: []const u8, payload: []const u8) ![]const u8 {
-        var client = std.http.Client{ .allocator = self.allocator };
-        defer client.deinit();
-
-        const result = client.fetch(.{
+        const result = self.http_client.fetch(.{
             .location = .{ .url = url },
             .payload = payload,
         }) catch |err| {
@@ -2,6 +2,75 @@
 /// Implements connection reuse and keep-alive
 const std = @import("std");
 
+/// TTL-bounded DNS cache keyed by host name.
+/// getAddressList doesn't surface record TTLs, so entries are capped
+/// at a fixed lifetime; literal IP addresses bypass the cache.
+pub const DnsCache = struct {
+    entries: std.StringHashMap(Entry),
+    mutex: std.Thread.Mutex,
+    allocator: std.mem.Allocator,
+
+    pub const TTL_SECONDS: i64 = 60;
+
+    const Entry = struct {
+        address: std.net.Address,
+        expires_at: i64,
+    };
+
+    pub fn init(allocator: std.mem.Allocator) DnsCache {
+        return .{
+            .entries = std.StringHashMap(Entry).init(allocator),
+            .mutex = .{},
+            .allocator = allocator,
+        };
+    }
+
+    pub fn deinit(self: *DnsCache) void {
+        var it = self.entries.iterator();
+        while (it.next()) |entry| {
+            self.allocator.free(entry.key_ptr.*);
+        }
+        self.entries.deinit();
+    }
+
+    /// Resolve host:port, serving from cache while the entry is fresh
+    pub fn resolve(self: *DnsCache, host: []const u8, port: u16) !std.net.Address {
+        // Literal addresses need no lookup (and no cache slot)
+        if (std.net.Address.parseIp(host, port)) |addr| {
+            return addr;
+        } else |_| {}
+
+        const now = std.time.timestamp();
+
+        self.mutex.lock();
+        if (self.entries.get(host)) |entry| {
+            if (entry.expires_at > now) {
+                var addr = entry.address;
+                self.mutex.unlock();
+                addr.setPort(port);
+                return addr;
+            }
+        }
+        self.mutex.unlock();
+
+        // Miss or expired: resolve outside the lock so slow lookups
+        // don't stall other checkouts
+        const list = try std.net.getAddressList(self.allocator, host, port);
+        defer list.deinit();
+        if (list.addrs.len == 0) return error.UnknownHostName;
+        const addr = list.addrs[0];
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        const gop = try self.entries.getOrPut(host);
+        if (!gop.found_existing) {
+            gop.key_ptr.* = try self.allocator.dupe(u8, host);
+        }
+        gop.value_ptr.* = .{ .address = addr, .expires_at = now + TTL_SECONDS };
+        return addr;
+    }
+};
+
 pub const Connection = struct {
     stream: std.net.Stream,
     host: []const u8,
@@ -28,15 +97,37 @@ pub const Connection = struct {
         };
     }
 
+    /// Like init(), but dials an already-resolved address (pool path:
+    /// resolution goes through the DNS cache exactly once per host)
+    pub fn initWithAddress(allocator: std.mem.Allocator, host: []const u8, port: u16, address: std.net.Address) !Connection {
+        const host_copy = try allocator.dupe(u8, host);
+        errdefer allocator.free(host_copy);
+
+        const stream = try std.net.tcpConnectToAddress(address);
+
+        return .{
+            .stream = stream,
+            .host = host_copy,
+            .port = port,
+            .last_used = std.time.timestamp(),
+            .in_use = false,
+            .allocator = allocator,
+        };
+    }
+
     pub fn deinit(self: *Connection) void {
         self.stream.close();
         self.allocator.free(self.host);
     }
 
     pub fn isAlive(self: *const Connection) bool {
-        // Connection is alive if used within last 60 seconds
+        return self.isAliveFor(60);
+    }
+
+    /// Whether the connection was used within the given idle window
+    pub fn isAliveFor(self: *const Connection, timeout_s: i64) bool {
         const now = std.time.timestamp();
-        return (now - self.last_used) < 60;
+        return (now - self.last_used) < timeout_s;
     }
 
     pub fn markUsed(self: *Connection) void {
@@ -50,17 +141,23 @@ pub const Connection = struct {
 };
 
 pub const ConnectionPool = struct {
-    connections: std.ArrayList(Connection),
+    // Heap-allocated so checkouts stay valid while the list grows
+    connections: std.ArrayList(*Connection),
     allocator: std.mem.Allocator,
     max_connections: usize,
     mutex: std.Thread.Mutex,
+    dns: DnsCache,
+    /// Idle connections older than this are dropped instead of reused
+    idle_timeout_s: i64,
 
     pub fn init(allocator: std.mem.Allocator, max_connections: usize) ConnectionPool {
         return .{
-            .connections = std.ArrayList(Connection){},
+            .connections = std.ArrayList(*Connection){},
             .allocator = allocator,
             .max_connections = max_connections,
             .mutex = .{},
+            .dns = DnsCache.init(allocator),
+            .idle_timeout_s = 60,
         };
     }
 
@@ -68,39 +165,69 @@ pub const ConnectionPool = struct {
         self.mutex.lock();
         defer self.mutex.unlock();
 
-        for (self.connections.items) |*conn| {
+        for (self.connections.items) |conn| {
             conn.deinit();
+            self.allocator.destroy(conn);
         }
         self.connections.deinit(self.allocator);
+        self.dns.deinit();
     }
 
-    /// Get a connection from the pool or create a new one
+    /// Get a keep-alive connection for host:port, reusing an idle one
+    /// when available. The dial itself runs outside the pool mutex so
+    /// one slow connect doesn't serialize every other checkout.
     pub fn acquire(self: *ConnectionPool, host: []const u8, port: u16) !*Connection {
         self.mutex.lock();
-        defer self.mutex.unlock();
 
-        // Try to find an existing idle connection for this host
-        for (self.connections.items) |*conn| {
+        // Reuse a fresh idle connection for this host
+        for (self.connections.items) |conn| {
             if (conn.in_use) continue;
             if (!std.mem.eql(u8, conn.host, host)) continue;
             if (conn.port != port) continue;
-            if (!conn.isAlive()) continue;
+            if (!conn.isAliveFor(self.idle_timeout_s)) continue;
 
             conn.markUsed();
+            self.mutex.unlock();
             return conn;
         }
 
-        // Create new connection if under limit
-        if (self.connections.items.len < self.max_connections) {
-            var conn = try Connection.init(self.allocator, host, port);
-            conn.markUsed();
-            try self.connections.append(self.allocator, conn);
-            return &self.connections.items[self.connections.items.len - 1];
+        // At the limit: evict the stalest idle connection (any host)
+        // rather than failing the checkout
+        if (self.connections.items.len >= self.max_connections) {
+            var oldest_idx: ?usize = null;
+            for (self.connections.items, 0..) |conn, i| {
+                if (conn.in_use) continue;
+                if (oldest_idx == null or conn.last_used < self.connections.items[oldest_idx.?].last_used) {
+                    oldest_idx = i;
+                }
+            }
+            const idx = oldest_idx orelse {
+                self.mutex.unlock();
+                return error.PoolExhausted;
+            };
+            const evicted = self.connections.orderedRemove(idx);
+            evicted.deinit();
+            self.allocator.destroy(evicted);
         }
+        self.mutex.unlock();
+
+        // Resolve through the cache and dial without holding the lock.
+        // Concurrent checkouts may briefly overshoot max_connections;
+        // eviction pulls the count back on the next full acquire.
+        const address = try self.dns.resolve(host, port);
+
+        const conn = try self.allocator.create(Connection);
+        errdefer self.allocator.destroy(conn);
+        conn.* = try Connection.initWithAddress(self.allocator, host, port, address);
+        conn.markUsed();
 
-        // Wait for a connection to become available (simple blocking)
-        // In production, this would use async/await
-        return error.PoolExhausted;
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.connections.append(self.allocator, conn) catch |err| {
+            conn.deinit();
+            return err;
+        };
+        return conn;
     }
 
     /// Release a connection back to the pool
@@ -108,6 +235,8 @@ pub const ConnectionPool = struct {
         self.mutex.lock();
         defer self.mutex.unlock();
 
+        // Idle timeout counts from release, not from last acquire
+        conn.last_used = std.time.timestamp();
         conn.markIdle();
     }
 
@@ -118,10 +247,11 @@ pub const ConnectionPool = struct {
 
         var i: usize = 0;
         while (i < self.connections.items.len) {
-            const conn = &self.connections.items[i];
-            if (!conn.in_use and !conn.isAlive()) {
-                var removed = self.connections.orderedRemove(i);
+            const conn = self.connections.items[i];
+            if (!conn.in_use and !conn.isAliveFor(self.idle_timeout_s)) {
+                const removed = self.connections.orderedRemove(i);
                 removed.deinit();
+                self.allocator.destroy(removed);
                 continue;
             }
             i += 1;
@@ -136,7 +266,7 @@ pub const ConnectionPool = struct {
         var active: usize = 0;
         var idle: usize = 0;
 
-        for (self.connections.items) |*conn| {
+        for (self.connections.items) |conn| {
             if (conn.in_use) {
                 active += 1;
             } else {
@@ -227,6 +357,31 @@ test "ConnectionPool cleanup" {
     try std.testing.expectEqual(@as(usize, 0), pool_stats.total);
 }
 
+test "DnsCache literal addresses bypass cache" {
+    var cache = DnsCache.init(std.testing.allocator);
+    defer cache.deinit();
+
+    const addr = try cache.resolve("127.0.0.1", 8080);
+    try std.testing.expectEqual(@as(u16, 8080), addr.getPort());
+    try std.testing.expectEqual(@as(u32, 0), cache.entries.count());
+}
+
+test "DnsCache serves fresh entries without lookup" {
+    var cache = DnsCache.init(std.testing.allocator);
+    defer cache.deinit();
+
+    // Seed an entry for a host that can't resolve; a hit proves the
+    // cache answered instead of the resolver
+    const key = try std.testing.allocator.dupe(u8, "cached.invalid");
+    try cache.entries.put(key, .{
+        .address = try std.net.Address.parseIp("192.0.2.1", 0),
+        .expires_at = std.time.timestamp() + DnsCache.TTL_SECONDS,
+    });
+
+    const addr = try cache.resolve("cached.invalid", 443);
+    try std.testing.expectEqual(@as(u16, 443), addr.getPort());
+}
+
 test "ConnectionAllocator arena" {
     const allocator = std.testing.allocator;
 
@@ -77,8 +77,15 @@ pub const Response = struct {
     version: []const u8,
     headers: Headers,
     body: []const u8,
+    /// File-backed body sent via sendfile (owned, closed in deinit).
+    /// Only writeTo() sends it; serialize() covers memory bodies.
+    body_file: ?std.fs.File = null,
+    body_file_len: u64 = 0,
     allocator: std.mem.Allocator,
 
+    /// Max bytes for status line + headers in the vectored send path
+    pub const MAX_HEAD_BYTES = 8192;
+
     pub fn init(allocator: std.mem.Allocator, status: Status) Response {
         return .{
             .status = status,
@@ -94,6 +101,17 @@ pub const Response = struct {
         if (self.body.len > 0) {
             self.allocator.free(self.body);
         }
+        self.closeBodyFile();
+    }
+
+    /// Close the file handle behind a sendfile body, if any. Arena-mode
+    /// dispatch skips deinit() because the arena reclaims the memory, but
+    /// the fd is not arena-owned and must be closed either way.
+    pub fn closeBodyFile(self: *Response) void {
+        if (self.body_file) |file| {
+            file.close();
+            self.body_file = null;
+        }
     }
 
     pub fn setHeader(self: *Response, key: []const u8, value: []const u8) !void {
@@ -127,6 +145,24 @@ pub const Response = struct {
         try self.setHeader("Content-Type", "text/html");
     }
 
+    /// Serve a file as the body via sendfile. The response takes ownership
+    /// of the handle and closes it in deinit.
+    pub fn setFileBody(self: *Response, file: std.fs.File, size: u64) !void {
+        if (self.body.len > 0) {
+            self.allocator.free(self.body);
+            self.body = &[_]u8{};
+        }
+        if (self.body_file) |old| {
+            old.close();
+        }
+        self.body_file = file;
+        self.body_file_len = size;
+
+        var buf: [32]u8 = undefined;
+        const len_str = try std.fmt.bufPrint(&buf, "{d}", .{size});
+        try self.setHeader("Content-Length", len_str);
+    }
+
     /// Serialize response to HTTP format
     pub fn serialize(self: *const Response, allocator: std.mem.Allocator) ![]u8 {
         var buf = std.ArrayList(u8){};
@@ -152,6 +188,93 @@ pub const Response = struct {
         return try buf.toOwnedSlice(allocator);
     }
 
+    /// Format status line + headers + blank line into the caller's buffer
+    /// (typically stack-allocated). The body is not copied - pair with
+    /// writeTo for a vectored send.
+    pub fn serializeHead(self: *const Response, buf: []u8) ![]const u8 {
+        var pos: usize = 0;
+
+        // Status line
+        pos += (try std.fmt.bufPrint(buf[pos..], "{s} {d} {s}\r\n", .{ self.version, self.status.toCode(), self.status.reason() })).len;
+
+        // Headers
+        var it = self.headers.map.iterator();
+        while (it.next()) |entry| {
+            pos += (try std.fmt.bufPrint(buf[pos..], "{s}: {s}\r\n", .{ entry.key_ptr.*, entry.value_ptr.* })).len;
+        }
+
+        // Empty line
+        pos += (try std.fmt.bufPrint(buf[pos..], "\r\n", .{})).len;
+
+        return buf[0..pos];
+    }
+
+    /// Zero-copy send: headers go out from a stack buffer and the body as a
+    /// second iovec straight from its existing allocation (writev), or via
+    /// sendfile for file-backed bodies. No full-response copy is made.
+    pub fn writeTo(self: *const Response, stream: std.net.Stream) !void {
+        var head_buf: [MAX_HEAD_BYTES]u8 = undefined;
+        const head = try self.serializeHead(&head_buf);
+
+        if (self.body_file) |file| {
+            return sendFileBody(stream.handle, file.handle, head, self.body_file_len);
+        }
+
+        var iovecs = [2]std.posix.iovec_const{
+            .{ .base = head.ptr, .len = head.len },
+            .{ .base = self.body.ptr, .len = self.body.len },
+        };
+        const count: usize = if (self.body.len > 0) 2 else 1;
+        try writevAll(stream.handle, iovecs[0..count]);
+    }
+
+    /// writev until every iovec is fully sent, advancing across partial
+    /// writes without copying
+    fn writevAll(fd: std.posix.fd_t, iovecs: []std.posix.iovec_const) !void {
+        var i: usize = 0;
+        while (i < iovecs.len) {
+            var n = try std.posix.writev(fd, iovecs[i..]);
+            while (n > 0) {
+                if (n >= iovecs[i].len) {
+                    n -= iovecs[i].len;
+                    i += 1;
+                    if (i == iovecs.len) break;
+                } else {
+                    iovecs[i].base += n;
+                    iovecs[i].len -= n;
+                    n = 0;
+                }
+            }
+        }
+    }
+
+    /// sendfile with the head passed as a header iovec, looping over
+    /// partial sends
+    fn sendFileBody(out_fd: std.posix.fd_t, in_fd: std.posix.fd_t, head: []const u8, file_len: u64) !void {
+        var head_sent: usize = 0;
+        var file_sent: u64 = 0;
+
+        while (head_sent < head.len or file_sent < file_len) {
+            if (head_sent < head.len) {
+                const headers = [1]std.posix.iovec_const{
+                    .{ .base = head.ptr + head_sent, .len = head.len - head_sent },
+                };
+                const n = try std.posix.sendfile(out_fd, in_fd, file_sent, file_len - file_sent, &headers, &.{}, 0);
+                const head_remaining = head.len - head_sent;
+                if (n <= head_remaining) {
+                    head_sent += n;
+                } else {
+                    head_sent = head.len;
+                    file_sent += n - head_remaining;
+                }
+            } else {
+                const n = try std.posix.sendfile(out_fd, in_fd, file_sent, file_len - file_sent, &.{}, &.{}, 0);
+                if (n == 0) break; // file truncated under us
+                file_sent += n;
+            }
+        }
+    }
+
     /// Parse HTTP response from raw bytes (zero-copy where possible)
     pub fn parse(allocator: std.mem.Allocator, data: []const u8) !Response {
         var lines = std.mem.splitSequence(u8, data, "\r\n");
@@ -254,6 +377,55 @@ test "Response creation and serialization" {
     try std.testing.expect(std.mem.indexOf(u8, serialized, "Hello, World!") != null);
 }
 
+test "Response vectored write" {
+    const allocator = std.testing.allocator;
+
+    var response = Response.init(allocator, .ok);
+    defer response.deinit();
+    try response.setTextBody("Hello, World!");
+
+    const fds = try std.posix.pipe();
+    defer std.posix.close(fds[0]);
+    defer std.posix.close(fds[1]);
+
+    const stream = std.net.Stream{ .handle = fds[1] };
+    try response.writeTo(stream);
+
+    var buf: [1024]u8 = undefined;
+    const n = try std.posix.read(fds[0], &buf);
+    const sent = buf[0..n];
+
+    try std.testing.expect(std.mem.indexOf(u8, sent, "HTTP/1.1 200 OK\r\n") != null);
+    try std.testing.expect(std.mem.endsWith(u8, sent, "\r\n\r\nHello, World!"));
+}
+
+test "Response sendfile body" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    try tmp.dir.writeFile(.{ .sub_path = "payload.txt", .data = "file payload bytes" });
+    const file = try tmp.dir.openFile("payload.txt", .{});
+
+    var response = Response.init(allocator, .ok);
+    defer response.deinit();
+    try response.setFileBody(file, 18); // response now owns the handle
+
+    const fds = try std.posix.pipe();
+    defer std.posix.close(fds[0]);
+    defer std.posix.close(fds[1]);
+
+    const stream = std.net.Stream{ .handle = fds[1] };
+    try response.writeTo(stream);
+
+    var buf: [1024]u8 = undefined;
+    const n = try std.posix.read(fds[0], &buf);
+    const sent = buf[0..n];
+
+    try std.testing.expect(std.mem.indexOf(u8, sent, "Content-Length: 18\r\n") != null);
+    try std.testing.expect(std.mem.endsWith(u8, sent, "\r\n\r\nfile payload bytes"));
+}
+
 test "Response parsing" {
     const allocator = std.testing.allocator;
 
@@ -128,16 +128,22 @@ pub const Router = struct {
 
     /// Handle request and generate response
     pub fn handle(self: *const Router, request: *const Request) !Response {
+        return self.handleWithAllocator(self.allocator, request);
+    }
+
+    /// Handle request with a caller-provided allocator (e.g. the server's
+    /// per-request arena) - the handler and response draw from it
+    pub fn handleWithAllocator(self: *const Router, allocator: std.mem.Allocator, request: *const Request) !Response {
         if (self.findRoute(request.method, request.path)) |route| {
-            return try route.handler(self.allocator, request);
+            return try route.handler(allocator, request);
         }
 
         // 404 Not Found
         if (self.not_found_handler) |handler| {
-            return try handler(self.allocator, request);
+            return try handler(allocator, request);
         }
 
-        var response = Response.init(self.allocator, .not_found);
+        var response = Response.init(allocator, .not_found);
         try response.setTextBody("404 Not Found");
         return response;
     }
@@ -20,6 +20,10 @@ pub const ServerConfig = struct {
     max_connections: usize = 1000,
     read_timeout_ms: u64 = 5000,
     write_timeout_ms: u64 = 5000,
+    /// Allocate each request's objects (parsed request, handler response,
+    /// serialized bytes) from a per-request arena that is freed wholesale
+    /// after the response is flushed, instead of piecemeal frees
+    use_request_arena: bool = true,
 };
 
 pub const Server = struct {
@@ -107,34 +111,51 @@ pub const Server = struct {
 
         const request_data = buf[0..bytes_read];
 
+        if (self.config.use_request_arena) {
+            // Everything the request touches comes from the arena and is
+            // released in one shot after the response is flushed
+            var arena = std.heap.ArenaAllocator.init(self.allocator);
+            defer arena.deinit();
+            try self.dispatch(arena.allocator(), connection.stream, request_data, false);
+        } else {
+            try self.dispatch(self.allocator, connection.stream, request_data, true);
+        }
+    }
+
+    /// Parse, route and respond using the given allocator. With
+    /// `free_piecemeal` false the caller owns the allocations (arena mode)
+    /// and the per-object deinits are skipped.
+    fn dispatch(self: *Server, allocator: std.mem.Allocator, stream: std.net.Stream, request_data: []const u8, free_piecemeal: bool) !void {
         // Parse request
-        var request = Request.parse(self.allocator, request_data) catch |err| {
+        var request = Request.parse(allocator, request_data) catch |err| {
             std.debug.print("Failed to parse request: {}\n", .{err});
-            return self.sendErrorResponse(connection.stream, .bad_request);
+            return self.sendErrorResponse(allocator, stream, .bad_request, free_piecemeal);
         };
-        defer request.deinit();
+        defer if (free_piecemeal) request.deinit();
 
         // Route and handle request
-        var response = self.router.handle(&request) catch |err| {
+        var response = self.router.handleWithAllocator(allocator, &request) catch |err| {
             std.debug.print("Handler error: {}\n", .{err});
-            return self.sendErrorResponse(connection.stream, .internal_server_error);
+            return self.sendErrorResponse(allocator, stream, .internal_server_error, free_piecemeal);
         };
-        defer response.deinit();
+        // The fd behind a sendfile body is not arena-owned: close it even
+        // when the arena is about to reclaim the response memory
+        defer if (free_piecemeal) response.deinit() else response.closeBodyFile();
 
         // Send response
-        try self.sendResponse(connection.stream, &response);
+        try self.sendResponse(stream, &response);
     }
 
     fn sendResponse(self: *Server, stream: std.net.Stream, response: *const Response) !void {
-        const data = try response.serialize(self.allocator);
-        defer self.allocator.free(data);
-
-        _ = try stream.write(data);
+        _ = self;
+        // Vectored send - headers from a stack buffer, body straight from
+        // its own allocation (sendfile for file-backed bodies)
+        try response.writeTo(stream);
     }
 
-    fn sendErrorResponse(self: *Server, stream: std.net.Stream, status: Status) !void {
-        var response = Response.init(self.allocator, status);
-        defer response.deinit();
+    fn sendErrorResponse(self: *Server, allocator: std.mem.Allocator, stream: std.net.Stream, status: Status, free_piecemeal: bool) !void {
+        var response = Response.init(allocator, status);
+        defer if (free_piecemeal) response.deinit();
 
         try response.setTextBody(status.reason());
         try self.sendResponse(stream, &response);
@@ -215,3 +236,33 @@ test "Server route registration" {
     const route = server.router.findRoute(.GET, "/test");
     try std.testing.expect(route != null);
 }
+
+test "request arena mode frees handler allocations wholesale" {
+    const allocator = std.testing.allocator;
+
+    var server = Server.init(allocator);
+    defer server.deinit();
+
+    try std.testing.expect(server.config.use_request_arena);
+
+    const handler = struct {
+        fn handle(alloc: std.mem.Allocator, req: *const Request) !Response {
+            _ = req;
+            var resp = Response.init(alloc, .ok);
+            // Allocated from the arena, never individually freed
+            const body = try std.fmt.allocPrint(alloc, "hello {d}", .{@as(u32, 7)});
+            try resp.setTextBody(body);
+            return resp;
+        }
+    }.handle;
+    try server.get("/arena", handler);
+
+    var arena = std.heap.ArenaAllocator.init(allocator);
+    defer arena.deinit();
+
+    var request = try Request.init(arena.allocator(), .GET, "/arena");
+    const response = try server.router.handleWithAllocator(arena.allocator(), &request);
+    // No request/response deinit - the arena reclaims everything at once
+    try std.testing.expectEqual(Status.ok, response.status);
+    try std.testing.expectEqualStrings("hello 7", response.body);
+}
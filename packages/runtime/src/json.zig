@@ -8,6 +8,16 @@ const parse_arena = @import("json/parse_arena.zig");
 pub const parse = @import("json/parse.zig");
 pub const JsonValue = @import("json/value.zig").JsonValue;
 
+// Streaming mode: memory-mapped input, top-level values yielded lazily
+// (flat memory use on multi-GB JSONL exports)
+pub const JsonStream = @import("json/stream.zig").JsonStream;
+
+/// Open a file as a lazy stream of top-level JSON values
+/// Python-ish: for obj in json.load_stream(path): ...
+pub fn loadStream(allocator: std.mem.Allocator, path: []const u8) !JsonStream {
+    return JsonStream.open(allocator, path);
+}
+
 /// Deserialize JSON string to PyObject (arena-allocated for speed!)
 /// Python: json.loads(json_str) -> obj
 /// Uses arena allocation: single malloc for entire parse, single free on cleanup
@@ -10,12 +10,27 @@ const number = @import("parse/number.zig");
 const string = @import("parse/string.zig");
 const array = @import("parse/array.zig");
 const object = @import("parse/object.zig");
+const structural = @import("structural.zig");
+
+/// Documents at least this large take the two-stage SIMD path; below it the
+/// index build costs more than byte-by-byte recursive descent saves
+const SIMD_INDEX_THRESHOLD = 256;
+
+/// Set up the circular parseValue dependencies of the container parsers.
+/// Idempotent - called by every entry point (parse, streaming reader).
+pub fn bindParsers() void {
+    array.setParseValueFn(&parseValue);
+    object.setParseValueFn(&parseValue);
+}
 
 /// Main entry point: parse JSON string into JsonValue
 pub fn parse(data: []const u8, allocator: std.mem.Allocator) JsonError!JsonValue {
     // Set up circular dependencies
-    array.setParseValueFn(&parseValue);
-    object.setParseValueFn(&parseValue);
+    bindParsers();
+
+    if (data.len >= SIMD_INDEX_THRESHOLD) {
+        return parseIndexed(data, allocator);
+    }
 
     const i = skipWhitespace(data, 0);
     if (i >= data.len) return JsonError.UnexpectedEndOfInput;
@@ -31,6 +46,193 @@ pub fn parse(data: []const u8, allocator: std.mem.Allocator) JsonError!JsonValue
     return result.value;
 }
 
+/// Two-stage parse: vectorized structural index first (stage 1), then value
+/// construction walking the index instead of the raw bytes (stage 2)
+pub fn parseIndexed(data: []const u8, allocator: std.mem.Allocator) JsonError!JsonValue {
+    var index = try structural.build(allocator, data);
+    defer index.deinit(allocator);
+
+    var walker = IndexedWalker{
+        .data = data,
+        .positions = index.positions,
+        .cursor = 0,
+        .allocator = allocator,
+    };
+
+    const start = skipWhitespace(data, 0);
+    if (start >= data.len) return JsonError.UnexpectedEndOfInput;
+
+    var result = try walker.parseValue(start);
+
+    // Check for trailing content
+    const final_pos = skipWhitespace(data, result.end);
+    if (final_pos < data.len) {
+        result.value.deinit(allocator);
+        return JsonError.UnexpectedToken;
+    }
+
+    return result.value;
+}
+
+/// Stage 2: recursive value construction driven by the structural index.
+/// Containers hop from one index entry to the next; leaves (numbers, strings,
+/// primitives) reuse the existing parse/ modules at the indexed offsets.
+const IndexedWalker = struct {
+    data: []const u8,
+    positions: []const u32,
+    cursor: usize,
+    allocator: std.mem.Allocator,
+
+    const ValueEnd = struct {
+        value: JsonValue,
+        end: usize, // byte offset just past the value
+    };
+
+    /// Consume the index entry that must sit exactly at byte i
+    fn expectEntry(self: *IndexedWalker, i: usize) JsonError!void {
+        if (self.cursor >= self.positions.len or self.positions[self.cursor] != i) {
+            return JsonError.UnexpectedToken;
+        }
+        self.cursor += 1;
+    }
+
+    /// Skip whitespace from `from` and consume the index entry there.
+    /// Returns its byte position; rejects stray bytes between tokens.
+    fn nextEntry(self: *IndexedWalker, from: usize) JsonError!usize {
+        const i = skipWhitespace(self.data, from);
+        if (i >= self.data.len) return JsonError.UnexpectedEndOfInput;
+        try self.expectEntry(i);
+        return i;
+    }
+
+    fn parseValue(self: *IndexedWalker, start: usize) JsonError!ValueEnd {
+        const i = skipWhitespace(self.data, start);
+        if (i >= self.data.len) return JsonError.UnexpectedEndOfInput;
+
+        switch (self.data[i]) {
+            '{' => {
+                try self.expectEntry(i);
+                return self.parseObject(i);
+            },
+            '[' => {
+                try self.expectEntry(i);
+                return self.parseArray(i);
+            },
+            '"' => {
+                try self.expectEntry(i);
+                const result = try string.parseString(self.data, i, self.allocator);
+                return .{ .value = result.value, .end = i + result.consumed };
+            },
+            '-', '0'...'9' => {
+                const result = try number.parseNumber(self.data, i);
+                return .{ .value = result.value, .end = i + result.consumed };
+            },
+            'n', 't', 'f' => {
+                const result = try primitives.parsePrimitive(self.data, i);
+                return .{ .value = result.value, .end = i + result.consumed };
+            },
+            else => return JsonError.UnexpectedToken,
+        }
+    }
+
+    /// open points at a consumed '[' entry
+    fn parseArray(self: *IndexedWalker, open: usize) JsonError!ValueEnd {
+        var arr = std.ArrayList(JsonValue){};
+        errdefer {
+            for (arr.items) |*item| {
+                item.deinit(self.allocator);
+            }
+            arr.deinit(self.allocator);
+        }
+
+        // Empty array?
+        const first = skipWhitespace(self.data, open + 1);
+        if (first < self.data.len and self.data[first] == ']') {
+            try self.expectEntry(first);
+            return .{ .value = .{ .array = arr }, .end = first + 1 };
+        }
+
+        var i = open + 1;
+        while (true) {
+            const value_result = try self.parseValue(i);
+            try arr.append(self.allocator, value_result.value);
+
+            // Next structural must be ',' or ']'
+            const sep = try self.nextEntry(value_result.end);
+            switch (self.data[sep]) {
+                ']' => return .{ .value = .{ .array = arr }, .end = sep + 1 },
+                ',' => {
+                    const after = skipWhitespace(self.data, sep + 1);
+                    if (after < self.data.len and self.data[after] == ']') {
+                        return JsonError.TrailingComma;
+                    }
+                    i = sep + 1;
+                },
+                else => return JsonError.UnexpectedToken,
+            }
+        }
+    }
+
+    /// open points at a consumed '{' entry
+    fn parseObject(self: *IndexedWalker, open: usize) JsonError!ValueEnd {
+        var obj = std.StringHashMap(JsonValue).init(self.allocator);
+        errdefer {
+            var it = obj.valueIterator();
+            while (it.next()) |val| {
+                val.deinit(self.allocator);
+            }
+            obj.deinit();
+        }
+
+        // Empty object?
+        const first = skipWhitespace(self.data, open + 1);
+        if (first < self.data.len and self.data[first] == '}') {
+            try self.expectEntry(first);
+            return .{ .value = .{ .object = obj }, .end = first + 1 };
+        }
+
+        var i = open + 1;
+        while (true) {
+            // Key (must be string, its opening quote is an index entry)
+            const key_pos = try self.nextEntry(i);
+            if (self.data[key_pos] != '"') return JsonError.UnexpectedToken;
+            const key_result = try string.parseString(self.data, key_pos, self.allocator);
+            const owned_key = key_result.value.string;
+            errdefer self.allocator.free(owned_key);
+
+            // Colon
+            const colon = try self.nextEntry(key_pos + key_result.consumed);
+            if (self.data[colon] != ':') return JsonError.UnexpectedToken;
+
+            // Value
+            const value_result = try self.parseValue(colon + 1);
+
+            // Check for duplicate key
+            if (obj.contains(owned_key)) {
+                var val = value_result.value;
+                val.deinit(self.allocator);
+                self.allocator.free(owned_key);
+                return JsonError.DuplicateKey;
+            }
+            try obj.put(owned_key, value_result.value);
+
+            // Next structural must be ',' or '}'
+            const sep = try self.nextEntry(value_result.end);
+            switch (self.data[sep]) {
+                '}' => return .{ .value = .{ .object = obj }, .end = sep + 1 },
+                ',' => {
+                    const after = skipWhitespace(self.data, sep + 1);
+                    if (after < self.data.len and self.data[after] == '}') {
+                        return JsonError.TrailingComma;
+                    }
+                    i = sep + 1;
+                },
+                else => return JsonError.UnexpectedToken,
+            }
+        }
+    }
+};
+
 /// Parse any JSON value based on first non-whitespace character
 pub fn parseValue(data: []const u8, pos: usize, allocator: std.mem.Allocator) JsonError!ParseResult(JsonValue) {
     const i = skipWhitespace(data, pos);
@@ -148,6 +350,32 @@ test "parse object with values" {
     try std.testing.expectEqual(@as(i64, 3), count.number_int);
 }
 
+test "indexed parse matches recursive descent" {
+    const allocator = std.testing.allocator;
+
+    // Build a document large enough to take the SIMD structural-index path
+    var buf = std.ArrayList(u8){};
+    defer buf.deinit(allocator);
+    try buf.appendSlice(allocator, "{\"items\": [");
+    for (0..50) |i| {
+        if (i > 0) try buf.appendSlice(allocator, ", ");
+        const item = try std.fmt.allocPrint(allocator, "{{\"id\": {d}, \"name\": \"item-{d}\", \"ok\": true}}", .{ i, i });
+        defer allocator.free(item);
+        try buf.appendSlice(allocator, item);
+    }
+    try buf.appendSlice(allocator, "], \"note\": \"braces {in} strings [are] fine\"}");
+    try std.testing.expect(buf.items.len >= SIMD_INDEX_THRESHOLD);
+
+    var value = try parse(buf.items, allocator);
+    defer value.deinit(allocator);
+
+    try std.testing.expect(value == .object);
+    const items = value.object.get("items").?;
+    try std.testing.expectEqual(@as(usize, 50), items.array.items.len);
+    try std.testing.expectEqual(@as(i64, 49), items.array.items[49].object.get("id").?.number_int);
+    try std.testing.expectEqualStrings("braces {in} strings [are] fine", value.object.get("note").?.string);
+}
+
 test "parse nested structure" {
     const allocator = std.testing.allocator;
     var value = try parse("{\"items\": [1, 2], \"meta\": {\"count\": 2}}", allocator);
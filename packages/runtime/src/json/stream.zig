@@ -0,0 +1,155 @@
+//! Streaming JSON reader - top-level values yielded lazily
+//!
+//! Usage:
+//!   var stream = try JsonStream.open(allocator, "export.jsonl");
+//!   defer stream.deinit();
+//!
+//!   while (try stream.next()) |value| {
+//!       var v = value;
+//!       defer v.deinit(allocator);
+//!       // process one top-level value
+//!   }
+//!
+//! Benefits:
+//! - File is memory-mapped, never copied into the heap
+//! - Only one top-level value is materialized at a time, so peak RSS stays
+//!   flat regardless of input size (multi-GB JSONL exports included)
+//! - Works for both JSONL and whitespace-separated concatenated documents
+
+const std = @import("std");
+const JsonValue = @import("value.zig").JsonValue;
+const skipWhitespace = @import("value.zig").skipWhitespace;
+const JsonError = @import("errors.zig").JsonError;
+const parse = @import("parse.zig");
+
+pub const JsonStream = struct {
+    allocator: std.mem.Allocator,
+    /// Document bytes - memory-mapped when opened from a file
+    data: []const u8,
+    /// Set when data is an mmap region that deinit must unmap
+    mapped: ?[]align(std.heap.page_size_min) u8,
+    pos: usize,
+
+    /// Memory-map a file and stream its top-level values.
+    /// Empty files yield no values.
+    pub fn open(allocator: std.mem.Allocator, path: []const u8) !JsonStream {
+        const file = if (std.fs.path.isAbsolute(path))
+            try std.fs.openFileAbsolute(path, .{})
+        else
+            try std.fs.cwd().openFile(path, .{});
+        defer file.close();
+
+        const size = (try file.stat()).size;
+        if (size == 0) {
+            return .{ .allocator = allocator, .data = &.{}, .mapped = null, .pos = 0 };
+        }
+
+        const region = try std.posix.mmap(
+            null,
+            size,
+            std.posix.PROT.READ,
+            .{ .TYPE = .PRIVATE },
+            file.handle,
+            0,
+        );
+
+        return .{
+            .allocator = allocator,
+            .data = region,
+            .mapped = region,
+            .pos = 0,
+        };
+    }
+
+    /// Stream top-level values from bytes already in memory (not copied)
+    pub fn fromSlice(allocator: std.mem.Allocator, data: []const u8) JsonStream {
+        return .{ .allocator = allocator, .data = data, .mapped = null, .pos = 0 };
+    }
+
+    pub fn deinit(self: *JsonStream) void {
+        if (self.mapped) |region| {
+            std.posix.munmap(region);
+        }
+    }
+
+    /// Parse and return the next top-level value, or null at end of input.
+    /// The caller owns the returned value and must deinit it.
+    pub fn next(self: *JsonStream) JsonError!?JsonValue {
+        parse.bindParsers();
+
+        self.pos = skipWhitespace(self.data, self.pos);
+        if (self.pos >= self.data.len) return null;
+
+        const result = try parse.parseValue(self.data, self.pos, self.allocator);
+        self.pos += result.consumed;
+        return result.value;
+    }
+
+    /// Bytes consumed so far - useful for progress reporting on large files
+    pub fn bytesRead(self: *const JsonStream) usize {
+        return self.pos;
+    }
+};
+
+test "stream yields top-level values one at a time" {
+    const allocator = std.testing.allocator;
+
+    var stream = JsonStream.fromSlice(allocator,
+        \\{"id": 1}
+        \\{"id": 2}
+        \\[3, 4]
+    );
+    defer stream.deinit();
+
+    var first = (try stream.next()).?;
+    defer first.deinit(allocator);
+    try std.testing.expectEqual(@as(i64, 1), first.object.get("id").?.number_int);
+
+    var second = (try stream.next()).?;
+    defer second.deinit(allocator);
+    try std.testing.expectEqual(@as(i64, 2), second.object.get("id").?.number_int);
+
+    var third = (try stream.next()).?;
+    defer third.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 2), third.array.items.len);
+
+    try std.testing.expectEqual(@as(?JsonValue, null), try stream.next());
+    // Stays null once exhausted
+    try std.testing.expectEqual(@as(?JsonValue, null), try stream.next());
+}
+
+test "stream reports malformed values" {
+    const allocator = std.testing.allocator;
+
+    var stream = JsonStream.fromSlice(allocator, "{\"ok\": true} {broken}");
+    defer stream.deinit();
+
+    var first = (try stream.next()).?;
+    defer first.deinit(allocator);
+
+    try std.testing.expectError(JsonError.UnexpectedToken, stream.next());
+}
+
+test "stream from memory-mapped file" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    try tmp.dir.writeFile(.{ .sub_path = "data.jsonl", .data = "1\n\"two\"\n{\"n\": 3}\n" });
+
+    const path = try tmp.dir.realpathAlloc(allocator, "data.jsonl");
+    defer allocator.free(path);
+
+    var stream = try JsonStream.open(allocator, path);
+    defer stream.deinit();
+
+    var count: usize = 0;
+    while (try stream.next()) |value| {
+        var v = value;
+        defer v.deinit(allocator);
+        count += 1;
+    }
+    try std.testing.expectEqual(@as(usize, 3), count);
+    try std.testing.expectEqual(stream.data.len, stream.bytesRead());
+}
@@ -0,0 +1,185 @@
+/// SIMD structural-index stage (simdjson-style stage 1)
+///
+/// Scans the document in 64-byte blocks with @Vector compares and emits the
+/// positions of all structural characters ({ } [ ] : ,) outside strings plus
+/// every string-opening quote. The value-construction stage in parse.zig then
+/// walks this index instead of the raw bytes, so the hot loop never touches
+/// input byte-by-byte.
+const std = @import("std");
+const JsonError = @import("errors.zig").JsonError;
+
+const BLOCK = 64;
+const LANES = 32;
+const Chunk = @Vector(LANES, u8);
+
+const EVEN_BITS: u64 = 0x5555555555555555;
+const ODD_BITS: u64 = ~EVEN_BITS;
+
+/// Positions of structural characters and opening quotes, ascending
+pub const StructuralIndex = struct {
+    positions: []u32,
+
+    pub fn deinit(self: *StructuralIndex, allocator: std.mem.Allocator) void {
+        allocator.free(self.positions);
+    }
+};
+
+/// Bitmask of bytes in a 64-byte block equal to `needle` (bit i = byte i)
+inline fn eqMask(lo: Chunk, hi: Chunk, comptime needle: u8) u64 {
+    const splat: Chunk = @splat(needle);
+    const lo_bits: u32 = @bitCast(lo == splat);
+    const hi_bits: u32 = @bitCast(hi == splat);
+    return @as(u64, lo_bits) | (@as(u64, hi_bits) << LANES);
+}
+
+/// Inclusive prefix XOR: bit i of the result is the parity of bits 0..i.
+/// Portable stand-in for simdjson's carry-less multiply by ~0.
+inline fn prefixXor(mask: u64) u64 {
+    var m = mask;
+    m ^= m << 1;
+    m ^= m << 2;
+    m ^= m << 4;
+    m ^= m << 8;
+    m ^= m << 16;
+    m ^= m << 32;
+    return m;
+}
+
+/// Bits of characters escaped by an odd-length backslash run (simdjson's
+/// find_odd_backslash_sequences). prev_odd carries a run that ended exactly
+/// at the previous block boundary.
+inline fn oddBackslashEnds(bs_bits: u64, prev_odd: *u64) u64 {
+    const start_edges = bs_bits & ~(bs_bits << 1);
+    const even_start_mask = EVEN_BITS ^ prev_odd.*;
+    const even_starts = start_edges & even_start_mask;
+    const odd_starts = start_edges & ~even_start_mask;
+
+    const even_carries = bs_bits +% even_starts;
+    const odd_result = @addWithOverflow(bs_bits, odd_starts);
+    var odd_carries = odd_result[0];
+    odd_carries |= prev_odd.*;
+    prev_odd.* = odd_result[1];
+
+    const even_carry_ends = even_carries & ~bs_bits;
+    const odd_carry_ends = odd_carries & ~bs_bits;
+    const even_start_odd_end = even_carry_ends & ODD_BITS;
+    const odd_start_even_end = odd_carry_ends & EVEN_BITS;
+    return even_start_odd_end | odd_start_even_end;
+}
+
+/// Build the structural index for a document.
+/// Returns UnexpectedEndOfInput if a string is left open at EOF.
+pub fn build(allocator: std.mem.Allocator, data: []const u8) JsonError!StructuralIndex {
+    var positions = std.ArrayList(u32){};
+    errdefer positions.deinit(allocator);
+
+    var prev_odd_backslash: u64 = 0;
+    var prev_in_string: u64 = 0; // all-ones while inside a string
+
+    var base: usize = 0;
+    while (base < data.len) : (base += BLOCK) {
+        // Last block is padded with spaces (neutral: not quote/backslash/structural)
+        var block: [BLOCK]u8 = undefined;
+        const remaining = data.len - base;
+        if (remaining >= BLOCK) {
+            @memcpy(&block, data[base..][0..BLOCK]);
+        } else {
+            @memset(&block, ' ');
+            @memcpy(block[0..remaining], data[base..]);
+        }
+
+        const lo: Chunk = block[0..LANES].*;
+        const hi: Chunk = block[LANES..BLOCK].*;
+
+        const bs_bits = eqMask(lo, hi, '\\');
+        const escaped = oddBackslashEnds(bs_bits, &prev_odd_backslash);
+
+        // Real quotes = quote bytes not preceded by an odd backslash run
+        const quote_bits = eqMask(lo, hi, '"') & ~escaped;
+
+        // in_string covers opening quote (inclusive) through closing quote (exclusive)
+        const in_string = prefixXor(quote_bits) ^ prev_in_string;
+        prev_in_string = @bitCast(@as(i64, @bitCast(in_string)) >> 63);
+
+        const structural_bits = eqMask(lo, hi, '{') |
+            eqMask(lo, hi, '}') |
+            eqMask(lo, hi, '[') |
+            eqMask(lo, hi, ']') |
+            eqMask(lo, hi, ':') |
+            eqMask(lo, hi, ',');
+
+        // Structurals outside strings, plus opening quotes (the bit of an
+        // opening quote is inside in_string; a closing quote's is not)
+        var index_bits = (structural_bits & ~in_string) | (quote_bits & in_string);
+
+        while (index_bits != 0) {
+            const tz: u6 = @truncate(@ctz(index_bits));
+            try positions.append(allocator, @intCast(base + tz));
+            index_bits &= index_bits - 1;
+        }
+    }
+
+    // A string still open at EOF can never terminate
+    if (prev_in_string != 0) return JsonError.UnexpectedEndOfInput;
+
+    return .{ .positions = try positions.toOwnedSlice(allocator) };
+}
+
+test "index flat array" {
+    const allocator = std.testing.allocator;
+    var index = try build(allocator, "[1, 2, 3]");
+    defer index.deinit(allocator);
+
+    // [ , , ]
+    try std.testing.expectEqualSlices(u32, &[_]u32{ 0, 2, 5, 8 }, index.positions);
+}
+
+test "index ignores structurals inside strings" {
+    const allocator = std.testing.allocator;
+    var index = try build(allocator, "{\"a{b}:\": \"[1,2]\"}");
+    defer index.deinit(allocator);
+
+    // { "(key) : "(value) }
+    try std.testing.expectEqualSlices(u32, &[_]u32{ 0, 1, 8, 10, 17 }, index.positions);
+}
+
+test "index handles escaped quotes" {
+    const allocator = std.testing.allocator;
+    // {"a\"b": 1} - the escaped quote must not end the key string
+    var index = try build(allocator, "{\"a\\\"b\": 1}");
+    defer index.deinit(allocator);
+
+    try std.testing.expectEqualSlices(u32, &[_]u32{ 0, 1, 7, 10 }, index.positions);
+}
+
+test "index handles even backslash run before quote" {
+    const allocator = std.testing.allocator;
+    // {"a\\": 1} - the double backslash does NOT escape the closing quote
+    var index = try build(allocator, "{\"a\\\\\": 1}");
+    defer index.deinit(allocator);
+
+    try std.testing.expectEqualSlices(u32, &[_]u32{ 0, 1, 6, 9 }, index.positions);
+}
+
+test "index spans block boundaries" {
+    const allocator = std.testing.allocator;
+
+    // String straddles the 64-byte boundary; brace inside it must be ignored
+    var buf: [80]u8 = undefined;
+    @memset(&buf, ' ');
+    buf[0] = '[';
+    buf[60] = '"';
+    buf[70] = '{';
+    buf[75] = '"';
+    buf[79] = ']';
+
+    var index = try build(allocator, &buf);
+    defer index.deinit(allocator);
+
+    try std.testing.expectEqualSlices(u32, &[_]u32{ 0, 60, 79 }, index.positions);
+}
+
+test "unterminated string is rejected" {
+    const allocator = std.testing.allocator;
+    try std.testing.expectError(JsonError.UnexpectedEndOfInput, build(allocator, "\"abc"));
+}
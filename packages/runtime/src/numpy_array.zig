@@ -485,128 +485,128 @@ pub const NumpyArray = struct {
     // ============================================================================
     // Element-wise operations (return new array)
     // ============================================================================
+    //
+    // All elementwise arithmetic funnels through fusedElementwise: a single
+    // @Vector loop over all inputs with exactly one output allocation. The
+    // codegen layer uses the same entry point to fuse whole expression chains
+    // (a*b + c becomes one loop instead of two temporaries and three sweeps).
+
+    /// Vector width for elementwise kernels (4 x f64 = 256-bit lanes)
+    const VEC_LEN = 4;
+    const Vec = @Vector(VEC_LEN, f64);
+
+    /// Tuple of N vector (or scalar) kernel arguments
+    fn ArgsTuple(comptime n: usize, comptime T: type) type {
+        comptime var types: [n]type = undefined;
+        inline for (&types) |*t| t.* = T;
+        return std.meta.Tuple(&types);
+    }
 
-    /// Element-wise addition
-    pub fn add(self: *NumpyArray, other: *NumpyArray, allocator: std.mem.Allocator) !*NumpyArray {
-        if (self.size != other.size) return error.ShapeMismatch;
+    /// Apply `kernel` elementwise across `inputs` into one freshly allocated
+    /// array. Inputs are a tuple of *NumpyArray (all the same size) and f64
+    /// scalars; scalars are splatted across vector lanes. The kernel takes
+    /// one anytype parameter per input and sees either @Vector(4, f64) or
+    /// f64, so write it with plain arithmetic:
+    ///
+    ///   NumpyArray.fusedElementwise(allocator, struct {
+    ///       inline fn k(a: anytype, b: anytype, c: anytype) @TypeOf(a) {
+    ///           return a * b + c;
+    ///       }
+    ///   }.k, .{ a, b, c })
+    pub fn fusedElementwise(allocator: std.mem.Allocator, comptime kernel: anytype, inputs: anytype) !*NumpyArray {
+        const fields = std.meta.fields(@TypeOf(inputs));
+        comptime var proto_index: ?usize = null;
+        inline for (fields, 0..) |field, i| {
+            if (field.type == *NumpyArray and proto_index == null) proto_index = i;
+        }
+        if (comptime proto_index == null) @compileError("fusedElementwise needs at least one NumpyArray input");
+        const proto = inputs[comptime proto_index.?];
 
-        const arr = try allocator.create(NumpyArray);
-        const data = try allocator.alloc(f64, self.size);
+        inline for (fields, 0..) |field, i| {
+            if (field.type == *NumpyArray) {
+                if (inputs[i].size != proto.size) return error.ShapeMismatch;
+            }
+        }
 
-        for (self.data, other.data, 0..) |a, b, i| {
-            data[i] = a + b;
+        const arr = try allocator.create(NumpyArray);
+        const data = try allocator.alloc(f64, proto.size);
+
+        var i: usize = 0;
+        while (i + VEC_LEN <= proto.size) : (i += VEC_LEN) {
+            var args: ArgsTuple(fields.len, Vec) = undefined;
+            inline for (fields, 0..) |field, j| {
+                args[j] = if (field.type == *NumpyArray)
+                    @as(Vec, inputs[j].data[i..][0..VEC_LEN].*)
+                else
+                    @as(Vec, @splat(@as(f64, inputs[j])));
+            }
+            data[i..][0..VEC_LEN].* = @call(.auto, kernel, args);
+        }
+        while (i < proto.size) : (i += 1) {
+            var args: ArgsTuple(fields.len, f64) = undefined;
+            inline for (fields, 0..) |field, j| {
+                args[j] = if (field.type == *NumpyArray) inputs[j].data[i] else @as(f64, inputs[j]);
+            }
+            data[i] = @call(.auto, kernel, args);
         }
 
-        const shape = try allocator.dupe(usize, self.shape);
-        const strides = try allocator.dupe(usize, self.strides);
+        const shape = try allocator.dupe(usize, proto.shape);
+        const strides = try allocator.dupe(usize, proto.strides);
 
         arr.* = .{
             .data = data,
             .shape = shape,
             .strides = strides,
-            .size = self.size,
+            .size = proto.size,
             .allocator = allocator,
         };
 
         return arr;
     }
 
+    /// Element-wise addition
+    pub fn add(self: *NumpyArray, other: *NumpyArray, allocator: std.mem.Allocator) !*NumpyArray {
+        return fusedElementwise(allocator, struct {
+            inline fn k(a: anytype, b: anytype) @TypeOf(a) {
+                return a + b;
+            }
+        }.k, .{ self, other });
+    }
+
     /// Element-wise subtraction
     pub fn subtract(self: *NumpyArray, other: *NumpyArray, allocator: std.mem.Allocator) !*NumpyArray {
-        if (self.size != other.size) return error.ShapeMismatch;
-
-        const arr = try allocator.create(NumpyArray);
-        const data = try allocator.alloc(f64, self.size);
-
-        for (self.data, other.data, 0..) |a, b, i| {
-            data[i] = a - b;
-        }
-
-        const shape = try allocator.dupe(usize, self.shape);
-        const strides = try allocator.dupe(usize, self.strides);
-
-        arr.* = .{
-            .data = data,
-            .shape = shape,
-            .strides = strides,
-            .size = self.size,
-            .allocator = allocator,
-        };
-
-        return arr;
+        return fusedElementwise(allocator, struct {
+            inline fn k(a: anytype, b: anytype) @TypeOf(a) {
+                return a - b;
+            }
+        }.k, .{ self, other });
     }
 
     /// Element-wise multiplication
     pub fn multiply(self: *NumpyArray, other: *NumpyArray, allocator: std.mem.Allocator) !*NumpyArray {
-        if (self.size != other.size) return error.ShapeMismatch;
-
-        const arr = try allocator.create(NumpyArray);
-        const data = try allocator.alloc(f64, self.size);
-
-        for (self.data, other.data, 0..) |a, b, i| {
-            data[i] = a * b;
-        }
-
-        const shape = try allocator.dupe(usize, self.shape);
-        const strides = try allocator.dupe(usize, self.strides);
-
-        arr.* = .{
-            .data = data,
-            .shape = shape,
-            .strides = strides,
-            .size = self.size,
-            .allocator = allocator,
-        };
-
-        return arr;
+        return fusedElementwise(allocator, struct {
+            inline fn k(a: anytype, b: anytype) @TypeOf(a) {
+                return a * b;
+            }
+        }.k, .{ self, other });
     }
 
     /// Element-wise division
     pub fn divide(self: *NumpyArray, other: *NumpyArray, allocator: std.mem.Allocator) !*NumpyArray {
-        if (self.size != other.size) return error.ShapeMismatch;
-
-        const arr = try allocator.create(NumpyArray);
-        const data = try allocator.alloc(f64, self.size);
-
-        for (self.data, other.data, 0..) |a, b, i| {
-            data[i] = a / b;
-        }
-
-        const shape = try allocator.dupe(usize, self.shape);
-        const strides = try allocator.dupe(usize, self.strides);
-
-        arr.* = .{
-            .data = data,
-            .shape = shape,
-            .strides = strides,
-            .size = self.size,
-            .allocator = allocator,
-        };
-
-        return arr;
+        return fusedElementwise(allocator, struct {
+            inline fn k(a: anytype, b: anytype) @TypeOf(a) {
+                return a / b;
+            }
+        }.k, .{ self, other });
     }
 
     /// Scalar multiplication
     pub fn multiplyScalar(self: *NumpyArray, scalar: f64, allocator: std.mem.Allocator) !*NumpyArray {
-        const arr = try allocator.create(NumpyArray);
-        const data = try allocator.alloc(f64, self.size);
-
-        for (self.data, 0..) |a, i| {
-            data[i] = a * scalar;
-        }
-
-        const shape = try allocator.dupe(usize, self.shape);
-        const strides = try allocator.dupe(usize, self.strides);
-
-        arr.* = .{
-            .data = data,
-            .shape = shape,
-            .strides = strides,
-            .size = self.size,
-            .allocator = allocator,
-        };
-
-        return arr;
+        return fusedElementwise(allocator, struct {
+            inline fn k(a: anytype, s: anytype) @TypeOf(a) {
+                return a * s;
+            }
+        }.k, .{ self, scalar });
     }
 
     /// Element-wise power
@@ -1231,6 +1231,47 @@ test "zeros and ones" {
     try std.testing.expectEqual(@as(f64, 1.0), arr_ones.get(0));
 }
 
+test "fused elementwise kernel" {
+    const allocator = std.testing.allocator;
+
+    // Odd length exercises both the vector loop and the scalar tail
+    var a_data: [11]f64 = undefined;
+    var b_data: [11]f64 = undefined;
+    var c_data: [11]f64 = undefined;
+    for (&a_data, &b_data, &c_data, 0..) |*a, *b, *c, i| {
+        a.* = @floatFromInt(i);
+        b.* = 2.0;
+        c.* = @floatFromInt(i * i);
+    }
+
+    const a = try NumpyArray.fromSlice(allocator, &a_data);
+    defer a.deinit();
+    const b = try NumpyArray.fromSlice(allocator, &b_data);
+    defer b.deinit();
+    const c = try NumpyArray.fromSlice(allocator, &c_data);
+    defer c.deinit();
+
+    // a*b + c in one loop with one output allocation
+    const result = try NumpyArray.fusedElementwise(allocator, struct {
+        inline fn k(va: anytype, vb: anytype, vc: anytype) @TypeOf(va) {
+            return va * vb + vc;
+        }
+    }.k, .{ a, b, c });
+    defer result.deinit();
+
+    for (result.data, 0..) |got, i| {
+        const fi: f64 = @floatFromInt(i);
+        try std.testing.expectEqual(fi * 2.0 + fi * fi, got);
+    }
+
+    // Scalars splat across lanes
+    const scaled = try a.multiplyScalar(0.5, allocator);
+    defer scaled.deinit();
+    for (scaled.data, 0..) |got, i| {
+        try std.testing.expectEqual(@as(f64, @floatFromInt(i)) * 0.5, got);
+    }
+}
+
 test "wrap in PyObject" {
     const allocator = std.testing.allocator;
 
@@ -12,7 +12,7 @@ pub const PyBool_Type = &runtime.PyBool_Type;
 var _Py_TrueStruct: PyBoolObject = .{
     .ob_base = .{
         .ob_base = .{
-            .ob_refcnt = 1, // Immortal
+            .ob_refcnt = runtime.IMMORTAL_REFCNT,
             .ob_type = PyBool_Type,
         },
         .ob_size = 1,
@@ -23,7 +23,7 @@ var _Py_TrueStruct: PyBoolObject = .{
 var _Py_FalseStruct: PyBoolObject = .{
     .ob_base = .{
         .ob_base = .{
-            .ob_refcnt = 1, // Immortal
+            .ob_refcnt = runtime.IMMORTAL_REFCNT,
             .ob_type = PyBool_Type,
         },
         .ob_size = 0,
@@ -7,10 +7,39 @@ pub const PyObject = runtime.PyObject;
 pub const PyLongObject = runtime.PyLongObject;
 pub const PyLong_Type = &runtime.PyLong_Type;
 
+// Interned small-int range (CPython caches [-5, 256])
+pub const SMALL_INT_MIN: i64 = -5;
+pub const SMALL_INT_MAX: i64 = 256;
+const N_SMALL_INTS = SMALL_INT_MAX - SMALL_INT_MIN + 1;
+
+// Immortal statics - hot loops summing list elements hit these instead of
+// the allocator. Refcount starts at IMMORTAL_REFCNT so decref never frees.
+var small_ints: [N_SMALL_INTS]PyLongObject = blk: {
+    var arr: [N_SMALL_INTS]PyLongObject = undefined;
+    for (&arr, 0..) |*obj, i| {
+        obj.* = .{
+            .ob_base = .{
+                .ob_base = .{
+                    .ob_refcnt = runtime.IMMORTAL_REFCNT,
+                    .ob_type = &runtime.PyLong_Type,
+                },
+                .ob_size = 1,
+            },
+            .ob_digit = @as(i64, @intCast(i)) + SMALL_INT_MIN,
+        };
+    }
+    break :blk arr;
+};
+
 /// Python integer type - wrapper around CPython-compatible PyLongObject
 pub const PyInt = struct {
     /// Create a new PyLongObject with the given value
+    /// Values in the small-int range return the interned immortal object
+    /// without allocating
     pub fn create(allocator: std.mem.Allocator, val: i64) !*PyObject {
+        if (val >= SMALL_INT_MIN and val <= SMALL_INT_MAX) {
+            return @ptrCast(&small_ints[@intCast(val - SMALL_INT_MIN)]);
+        }
         const long_obj = try allocator.create(PyLongObject);
         long_obj.* = PyLongObject{
             .ob_base = .{
@@ -54,3 +83,30 @@ pub fn PyLong_AsLong(obj: *PyObject) callconv(.C) c_long {
 pub fn PyLong_AsLongLong(obj: *PyObject) callconv(.C) c_longlong {
     return PyInt.getValue(obj);
 }
+
+test "small ints are interned and immortal" {
+    const allocator = std.testing.allocator;
+
+    // Same pointer both times, no allocation (testing.allocator would
+    // report a leak if create boxed these)
+    const a = try PyInt.create(allocator, 42);
+    const b = try PyInt.create(allocator, 42);
+    try std.testing.expect(a == b);
+    try std.testing.expectEqual(@as(i64, 42), PyInt.getValue(a));
+
+    // Boundaries of the cached range
+    const lo = try PyInt.create(allocator, SMALL_INT_MIN);
+    const hi = try PyInt.create(allocator, SMALL_INT_MAX);
+    try std.testing.expectEqual(@as(i64, -5), PyInt.getValue(lo));
+    try std.testing.expectEqual(@as(i64, 256), PyInt.getValue(hi));
+
+    // Decref on an interned int must not free it
+    runtime.decref(a, allocator);
+    try std.testing.expectEqual(@as(i64, 42), PyInt.getValue(a));
+
+    // Outside the range still boxes
+    const big = try PyInt.create(allocator, 1000);
+    try std.testing.expect(big != a);
+    try std.testing.expectEqual(@as(i64, 1000), PyInt.getValue(big));
+    runtime.decref(big, allocator);
+}
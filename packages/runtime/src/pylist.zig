@@ -7,17 +7,122 @@ pub const PyObject = runtime.PyObject;
 pub const PyListObject = runtime.PyListObject;
 pub const PyList_Type = &runtime.PyList_Type;
 const PyLongObject = runtime.PyLongObject;
+const PyFloatObject = runtime.PyFloatObject;
 
 const incref = runtime.incref;
 const decref = runtime.decref;
 const PythonError = runtime.PythonError;
 
+/// Lanes for vectorized reductions (4 x 64-bit = one AVX2 register)
+const VECTOR_LEN = 4;
+
+/// Every mirror alloc/free goes through this one allocator. The boxed
+/// item array travels with whichever allocator created the list, but
+/// mutators don't receive that allocator, so the mirror is pinned to a
+/// fixed global one instead of guessing.
+const mirror_allocator = std.heap.page_allocator;
+
 /// Python list type - wrapper around CPython-compatible PyListObject
 pub const PyList = struct {
     // Legacy fields for backwards compatibility (not used in new layout)
     items: std.ArrayList(*PyObject) = undefined,
     allocator: std.mem.Allocator = undefined,
 
+    /// Drop the unboxed mirror and pin the list to boxed-only form.
+    /// Called by mutators that edit in place - keeping the mirror in
+    /// sync through them costs more than the fast path saves.
+    fn demoteToMixed(list_obj: *PyListObject) void {
+        freeMirror(list_obj);
+        list_obj.store_tag = .mixed;
+    }
+
+    /// Release the unboxed mirror if present. Safe to call on lists
+    /// that never had one; deallocation (runtime.decref) relies on this
+    /// so homogeneous lists don't leak their mirror.
+    pub fn freeMirror(list_obj: *PyListObject) void {
+        if (list_obj.unboxed) |payload| {
+            const allocated: usize = @intCast(list_obj.allocated);
+            mirror_allocator.free(payload[0..allocated]);
+            list_obj.unboxed = null;
+        }
+    }
+
+    /// Allocate the mirror array (capacity tracks `allocated`)
+    fn ensureMirror(list_obj: *PyListObject) !void {
+        if (list_obj.unboxed != null) return;
+        const allocated: usize = @intCast(list_obj.allocated);
+        const payload = try mirror_allocator.alloc(i64, allocated);
+        list_obj.unboxed = payload.ptr;
+    }
+
+    /// Maintain the unboxed mirror after a boxed append at index `idx`
+    fn mirrorAppend(list_obj: *PyListObject, item: *PyObject, idx: usize) !void {
+        switch (list_obj.store_tag) {
+            .mixed => {},
+            .empty => {
+                // Lists filled outside append() (JSON parser, str.split)
+                // keep the .empty tag with a nonzero size; they have no
+                // mirror to extend, so pin them to boxed form
+                if (idx != 0) {
+                    list_obj.store_tag = .mixed;
+                    return;
+                }
+                if (runtime.PyLong_Check(item)) {
+                    try ensureMirror(list_obj);
+                    const long_obj: *PyLongObject = @ptrCast(@alignCast(item));
+                    list_obj.unboxed.?[0] = long_obj.ob_digit;
+                    list_obj.store_tag = .int;
+                } else if (runtime.PyFloat_Check(item)) {
+                    try ensureMirror(list_obj);
+                    const float_obj: *PyFloatObject = @ptrCast(@alignCast(item));
+                    list_obj.unboxed.?[0] = @bitCast(float_obj.ob_fval);
+                    list_obj.store_tag = .float;
+                } else {
+                    list_obj.store_tag = .mixed;
+                }
+            },
+            .int => {
+                if (runtime.PyLong_Check(item)) {
+                    const long_obj: *PyLongObject = @ptrCast(@alignCast(item));
+                    list_obj.unboxed.?[idx] = long_obj.ob_digit;
+                } else {
+                    demoteToMixed(list_obj);
+                }
+            },
+            .float => {
+                if (runtime.PyFloat_Check(item)) {
+                    const float_obj: *PyFloatObject = @ptrCast(@alignCast(item));
+                    list_obj.unboxed.?[idx] = @bitCast(float_obj.ob_fval);
+                } else {
+                    demoteToMixed(list_obj);
+                }
+            },
+        }
+    }
+
+    /// Contiguous unboxed view of an all-int list, or null when only
+    /// the boxed form exists. Valid until the next mutation.
+    pub fn asIntSlice(obj: *PyObject) ?[]const i64 {
+        std.debug.assert(runtime.PyList_Check(obj));
+        const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+        if (list_obj.store_tag != .int) return null;
+        const payload = list_obj.unboxed orelse return null;
+        const size: usize = @intCast(list_obj.ob_base.ob_size);
+        return payload[0..size];
+    }
+
+    /// Contiguous unboxed view of an all-float list, or null when only
+    /// the boxed form exists. Valid until the next mutation.
+    pub fn asFloatSlice(obj: *PyObject) ?[]const f64 {
+        std.debug.assert(runtime.PyList_Check(obj));
+        const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+        if (list_obj.store_tag != .float) return null;
+        const payload = list_obj.unboxed orelse return null;
+        const size: usize = @intCast(list_obj.ob_base.ob_size);
+        const floats: [*]const f64 = @ptrCast(payload);
+        return floats[0..size];
+    }
+
     /// Create a new empty PyListObject
     pub fn create(allocator: std.mem.Allocator) !*PyObject {
         const list_obj = try allocator.create(PyListObject);
@@ -78,6 +183,16 @@ pub const PyList = struct {
                 allocator.free(list_obj.ob_item[0..allocated]);
             }
 
+            // Grow the unboxed mirror in lockstep (capacity invariant)
+            if (list_obj.unboxed) |payload| {
+                const new_payload = try mirror_allocator.alloc(i64, new_capacity);
+                if (size > 0) {
+                    @memcpy(new_payload[0..size], payload[0..size]);
+                }
+                mirror_allocator.free(payload[0..allocated]);
+                list_obj.unboxed = new_payload.ptr;
+            }
+
             list_obj.ob_item = new_items.ptr;
             list_obj.allocated = @intCast(new_capacity);
         }
@@ -86,6 +201,8 @@ pub const PyList = struct {
         list_obj.ob_item[size] = item;
         list_obj.ob_base.ob_size += 1;
         incref(item);
+
+        try mirrorAppend(list_obj, item, size);
     }
 
     /// Pop last item from list
@@ -262,6 +379,7 @@ pub const PyList = struct {
                 const item_obj: *PyLongObject = @ptrCast(@alignCast(item));
                 const value_obj: *PyLongObject = @ptrCast(@alignCast(value));
                 if (item_obj.ob_digit == value_obj.ob_digit) {
+                    demoteToMixed(list_obj);
                     // Shift remaining items
                     var j: usize = i;
                     while (j < size - 1) : (j += 1) {
@@ -283,6 +401,12 @@ pub const PyList = struct {
 
         if (size <= 1) return;
 
+        // The mirror follows the same permutation (bit pattern swap
+        // works for both i64 and f64 payloads)
+        if (list_obj.unboxed) |payload| {
+            std.mem.reverse(i64, payload[0..size]);
+        }
+
         var i: usize = 0;
         var j: usize = size - 1;
         while (i < j) {
@@ -339,6 +463,10 @@ pub const PyList = struct {
         const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
         _ = allocator;
 
+        // Demote before any growth so the mirror's capacity invariant
+        // (mirror capacity == allocated) holds at free time
+        demoteToMixed(list_obj);
+
         const list_len: i64 = list_obj.ob_base.ob_size;
         var index_pos: i64 = idx;
 
@@ -391,6 +519,11 @@ pub const PyList = struct {
         }
 
         list_obj.ob_base.ob_size = 0;
+
+        // Empty again: release the mirror and let the next append
+        // re-establish a homogeneous tag
+        freeMirror(list_obj);
+        list_obj.store_tag = .empty;
     }
 
     /// Sort list (simple bubble sort for integers)
@@ -401,6 +534,8 @@ pub const PyList = struct {
 
         if (size <= 1) return;
 
+        demoteToMixed(list_obj);
+
         var i: usize = 0;
         while (i < size) : (i += 1) {
             var j: usize = 0;
@@ -446,6 +581,10 @@ pub const PyList = struct {
 
         if (size == 0) return 0;
 
+        if (asIntSlice(obj)) |values| {
+            return minVecInt(values);
+        }
+
         var min_val: i64 = std.math.maxInt(i64);
         for (0..size) |i| {
             if (runtime.PyLong_Check(list_obj.ob_item[i])) {
@@ -466,6 +605,10 @@ pub const PyList = struct {
 
         if (size == 0) return 0;
 
+        if (asIntSlice(obj)) |values| {
+            return maxVecInt(values);
+        }
+
         var max_val: i64 = std.math.minInt(i64);
         for (0..size) |i| {
             if (runtime.PyLong_Check(list_obj.ob_item[i])) {
@@ -484,6 +627,10 @@ pub const PyList = struct {
         const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
         const size: usize = @intCast(list_obj.ob_base.ob_size);
 
+        if (asIntSlice(obj)) |values| {
+            return sumVecInt(values);
+        }
+
         var total: i64 = 0;
         for (0..size) |i| {
             if (runtime.PyLong_Check(list_obj.ob_item[i])) {
@@ -493,8 +640,163 @@ pub const PyList = struct {
         }
         return total;
     }
+
+    /// Get minimum value in an all-float list
+    pub fn minFloat(obj: *PyObject) f64 {
+        std.debug.assert(runtime.PyList_Check(obj));
+        const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+        const size: usize = @intCast(list_obj.ob_base.ob_size);
+
+        if (size == 0) return 0;
+
+        if (asFloatSlice(obj)) |values| {
+            return minVecFloat(values);
+        }
+
+        var min_val: f64 = std.math.inf(f64);
+        for (0..size) |i| {
+            if (runtime.PyFloat_Check(list_obj.ob_item[i])) {
+                const float_obj: *PyFloatObject = @ptrCast(@alignCast(list_obj.ob_item[i]));
+                if (float_obj.ob_fval < min_val) {
+                    min_val = float_obj.ob_fval;
+                }
+            }
+        }
+        return min_val;
+    }
+
+    /// Get maximum value in an all-float list
+    pub fn maxFloat(obj: *PyObject) f64 {
+        std.debug.assert(runtime.PyList_Check(obj));
+        const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+        const size: usize = @intCast(list_obj.ob_base.ob_size);
+
+        if (size == 0) return 0;
+
+        if (asFloatSlice(obj)) |values| {
+            return maxVecFloat(values);
+        }
+
+        var max_val: f64 = -std.math.inf(f64);
+        for (0..size) |i| {
+            if (runtime.PyFloat_Check(list_obj.ob_item[i])) {
+                const float_obj: *PyFloatObject = @ptrCast(@alignCast(list_obj.ob_item[i]));
+                if (float_obj.ob_fval > max_val) {
+                    max_val = float_obj.ob_fval;
+                }
+            }
+        }
+        return max_val;
+    }
+
+    /// Sum all values in an all-float list
+    pub fn sumFloat(obj: *PyObject) f64 {
+        std.debug.assert(runtime.PyList_Check(obj));
+        const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+        const size: usize = @intCast(list_obj.ob_base.ob_size);
+
+        if (asFloatSlice(obj)) |values| {
+            return sumVecFloat(values);
+        }
+
+        var total: f64 = 0;
+        for (0..size) |i| {
+            if (runtime.PyFloat_Check(list_obj.ob_item[i])) {
+                const float_obj: *PyFloatObject = @ptrCast(@alignCast(list_obj.ob_item[i]));
+                total += float_obj.ob_fval;
+            }
+        }
+        return total;
+    }
 };
 
+// Vectorized reductions over the unboxed mirror. Wrapping adds keep
+// the int lanes reassociable; overflow already truncates with our
+// i64-backed ints.
+fn sumVecInt(values: []const i64) i64 {
+    var acc: @Vector(VECTOR_LEN, i64) = @splat(0);
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, i64) = values[i..][0..VECTOR_LEN].*;
+        acc +%= chunk;
+    }
+    var total: i64 = @reduce(.Add, acc);
+    while (i < values.len) : (i += 1) {
+        total +%= values[i];
+    }
+    return total;
+}
+
+fn minVecInt(values: []const i64) i64 {
+    var acc: @Vector(VECTOR_LEN, i64) = @splat(std.math.maxInt(i64));
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, i64) = values[i..][0..VECTOR_LEN].*;
+        acc = @min(acc, chunk);
+    }
+    var result: i64 = @reduce(.Min, acc);
+    while (i < values.len) : (i += 1) {
+        result = @min(result, values[i]);
+    }
+    return result;
+}
+
+fn maxVecInt(values: []const i64) i64 {
+    var acc: @Vector(VECTOR_LEN, i64) = @splat(std.math.minInt(i64));
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, i64) = values[i..][0..VECTOR_LEN].*;
+        acc = @max(acc, chunk);
+    }
+    var result: i64 = @reduce(.Max, acc);
+    while (i < values.len) : (i += 1) {
+        result = @max(result, values[i]);
+    }
+    return result;
+}
+
+fn sumVecFloat(values: []const f64) f64 {
+    var acc: @Vector(VECTOR_LEN, f64) = @splat(0);
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, f64) = values[i..][0..VECTOR_LEN].*;
+        acc += chunk;
+    }
+    var total: f64 = @reduce(.Add, acc);
+    while (i < values.len) : (i += 1) {
+        total += values[i];
+    }
+    return total;
+}
+
+fn minVecFloat(values: []const f64) f64 {
+    var acc: @Vector(VECTOR_LEN, f64) = @splat(std.math.inf(f64));
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, f64) = values[i..][0..VECTOR_LEN].*;
+        acc = @min(acc, chunk);
+    }
+    var result: f64 = @reduce(.Min, acc);
+    while (i < values.len) : (i += 1) {
+        result = @min(result, values[i]);
+    }
+    return result;
+}
+
+fn maxVecFloat(values: []const f64) f64 {
+    var acc: @Vector(VECTOR_LEN, f64) = @splat(-std.math.inf(f64));
+    var i: usize = 0;
+    while (i + VECTOR_LEN <= values.len) : (i += VECTOR_LEN) {
+        const chunk: @Vector(VECTOR_LEN, f64) = values[i..][0..VECTOR_LEN].*;
+        acc = @max(acc, chunk);
+    }
+    var result: f64 = @reduce(.Max, acc);
+    while (i < values.len) : (i += 1) {
+        result = @max(result, values[i]);
+    }
+    return result;
+}
+
 // CPython-compatible C API functions
 pub fn PyList_New(size: runtime.Py_ssize_t) callconv(.C) *PyObject {
     const allocator = std.heap.page_allocator;
@@ -529,8 +831,62 @@ pub fn PyList_GetItem(obj: *PyObject, idx: runtime.Py_ssize_t) callconv(.C) *PyO
 
 pub fn PyList_SetItem(obj: *PyObject, idx: runtime.Py_ssize_t, item: *PyObject) callconv(.C) c_int {
     const list_obj: *PyListObject = @ptrCast(@alignCast(obj));
+    PyList.demoteToMixed(list_obj);
     const old_item = list_obj.ob_item[@intCast(idx)];
     list_obj.ob_item[@intCast(idx)] = item;
     runtime.Py_DECREF(old_item);
     return 0;
 }
+
+test "append builds an int mirror and reductions use it" {
+    const allocator = std.testing.allocator;
+
+    const list = try PyList.create(allocator);
+    defer runtime.decref(list, allocator);
+
+    // Small ints are interned, so the boxed items cost nothing here
+    try PyList.append(list, try runtime.PyInt.create(allocator, 3));
+    try PyList.append(list, try runtime.PyInt.create(allocator, 1));
+    try PyList.append(list, try runtime.PyInt.create(allocator, 2));
+
+    const values = PyList.asIntSlice(list) orelse return error.TestExpectedMirror;
+    try std.testing.expectEqualSlices(i64, &.{ 3, 1, 2 }, values);
+
+    try std.testing.expectEqual(@as(i64, 6), PyList.sum(list));
+    try std.testing.expectEqual(@as(i64, 1), PyList.min(list));
+    try std.testing.expectEqual(@as(i64, 3), PyList.max(list));
+}
+
+test "mixed append demotes the mirror" {
+    const allocator = std.testing.allocator;
+
+    const list = try PyList.create(allocator);
+    defer runtime.decref(list, allocator);
+
+    try PyList.append(list, try runtime.PyInt.create(allocator, 1));
+    try PyList.append(list, try runtime.PyFloat.create(allocator, 2.5));
+
+    // Heterogeneous contents fall back to boxed-only form
+    try std.testing.expect(PyList.asIntSlice(list) == null);
+    try std.testing.expect(PyList.asFloatSlice(list) == null);
+}
+
+test "clear releases the mirror and resets the tag" {
+    const allocator = std.testing.allocator;
+
+    const list = try PyList.create(allocator);
+    defer runtime.decref(list, allocator);
+
+    try PyList.append(list, try runtime.PyInt.create(allocator, 7));
+    const list_obj: *PyListObject = @ptrCast(@alignCast(list));
+    try std.testing.expect(list_obj.unboxed != null);
+
+    PyList.clear(allocator, list);
+    try std.testing.expect(list_obj.unboxed == null);
+    try std.testing.expectEqual(runtime.ListStoreTag.empty, list_obj.store_tag);
+
+    // A fresh append after clear re-establishes a homogeneous tag
+    try PyList.append(list, try runtime.PyFloat.create(allocator, 1.5));
+    const floats = PyList.asFloatSlice(list) orelse return error.TestExpectedMirror;
+    try std.testing.expectEqualSlices(f64, &.{1.5}, floats);
+}
@@ -14,6 +14,7 @@ pub const PyString = struct {
 
     // Core operations
     pub const create = core.PyString.create;
+    pub const intern = core.PyString.intern;
     pub const createOwned = core.PyString.createOwned;
     pub const createBorrowed = core.PyString.createBorrowed;
     pub const isBorrowed = core.PyString.isBorrowed;
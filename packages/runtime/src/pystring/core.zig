@@ -10,6 +10,28 @@ const PythonError = runtime.PythonError;
 // Unicode state flags (simplified from CPython)
 const UNICODE_ASCII: u32 = 0x0001;
 const UNICODE_READY: u32 = 0x0002;
+/// Character data lives inline behind the header (single allocation)
+const UNICODE_INLINE: u32 = 0x0004;
+/// Interned immortal string - never freed, comparable by pointer
+const UNICODE_INTERNED: u32 = 0x0008;
+
+/// Strings up to this length are stored inline behind the header,
+/// turning the usual header + data pair into one allocation
+pub const SMALL_STRING_MAX = 23;
+
+/// Header plus inline character buffer, allocated as one block. Consumers
+/// only ever see the PyUnicodeObject; data points into buf.
+const SmallUnicodeObject = extern struct {
+    base: PyUnicodeObject,
+    buf: [SMALL_STRING_MAX + 1]u8,
+};
+
+// Intern table for identifier-like strings (dict keys, attribute names).
+// Entries are immortal, so the byte keys - which point into the interned
+// objects themselves - stay valid forever. The table's own storage comes
+// from the page allocator to stay independent of caller allocators.
+var intern_mutex: std.Thread.Mutex = .{};
+var intern_table: ?std.StringHashMap(*PyObject) = null;
 
 /// Python string type using CPython-compatible PyUnicodeObject
 pub const PyString = struct {
@@ -18,7 +40,26 @@ pub const PyString = struct {
     source: ?*PyObject = null,
 
     pub fn create(allocator: std.mem.Allocator, str: []const u8) !*PyObject {
+        // Small-string path: one allocation, data inline behind the header
+        if (str.len <= SMALL_STRING_MAX) {
+            const small = try allocator.create(SmallUnicodeObject);
+            small.base = PyUnicodeObject{
+                .ob_base = .{
+                    .ob_refcnt = 1,
+                    .ob_type = PyUnicode_Type,
+                },
+                .length = @intCast(str.len),
+                .hash = -1, // Not computed yet
+                .state = UNICODE_ASCII | UNICODE_READY | UNICODE_INLINE,
+                ._padding = 0,
+                .data = &small.buf,
+            };
+            @memcpy(small.buf[0..str.len], str);
+            return @ptrCast(&small.base);
+        }
+
         const str_obj = try allocator.create(PyUnicodeObject);
+        errdefer allocator.destroy(str_obj);
 
         // Copy string data
         const owned = try allocator.dupe(u8, str);
@@ -37,17 +78,52 @@ pub const PyString = struct {
         return @ptrCast(str_obj);
     }
 
+    /// Intern an identifier-like string: the same bytes always return the
+    /// same immortal object, so callers (dict lookups, attribute access)
+    /// can compare by pointer before falling back to byte comparison
+    pub fn intern(allocator: std.mem.Allocator, str: []const u8) !*PyObject {
+        // Interned objects outlive every caller, so they come from the
+        // page allocator regardless of the caller's allocator
+        _ = allocator;
+
+        intern_mutex.lock();
+        defer intern_mutex.unlock();
+
+        if (intern_table == null) {
+            intern_table = std.StringHashMap(*PyObject).init(std.heap.page_allocator);
+        }
+        if (intern_table.?.get(str)) |obj| {
+            return obj;
+        }
+
+        const obj = try create(std.heap.page_allocator, str);
+        const str_obj: *PyUnicodeObject = @ptrCast(@alignCast(obj));
+        str_obj.ob_base.ob_refcnt = runtime.IMMORTAL_REFCNT;
+        str_obj.state |= UNICODE_INTERNED;
+        try intern_table.?.put(getValue(obj), obj);
+        return obj;
+    }
+
     /// Check if this string is borrowed (COW) - not used in new layout
     pub fn isBorrowed(obj: *PyObject) bool {
         _ = obj;
         return false; // New layout doesn't use COW
     }
 
-    /// Free PyString resources
+    /// Free PyString resources (layout-aware: inline small strings are a
+    /// single block, interned strings are immortal and never freed)
     pub fn deinit(obj: *PyObject, allocator: std.mem.Allocator) void {
         std.debug.assert(runtime.PyUnicode_Check(obj));
         const str_obj: *PyUnicodeObject = @ptrCast(@alignCast(obj));
 
+        if (str_obj.state & UNICODE_INTERNED != 0) return;
+
+        if (str_obj.state & UNICODE_INLINE != 0) {
+            const small: *SmallUnicodeObject = @ptrCast(@alignCast(obj));
+            allocator.destroy(small);
+            return;
+        }
+
         const str_len: usize = @intCast(str_obj.length);
         if (str_len > 0) {
             allocator.free(str_obj.data[0..str_len]);
@@ -102,11 +178,9 @@ pub const PyString = struct {
             return PythonError.IndexError;
         }
 
-        // Return single character as a new string
-        const result = try allocator.alloc(u8, 1);
-        result[0] = str_obj.data[idx];
-
-        return createOwned(allocator, result);
+        // Single characters take the inline small-string path
+        const ch = [1]u8{str_obj.data[idx]};
+        return create(allocator, &ch);
     }
 
     pub fn charAt(allocator: std.mem.Allocator, obj: *PyObject, index_val: i64) !*PyObject {
@@ -121,11 +195,9 @@ pub const PyString = struct {
             return PythonError.IndexError;
         }
 
-        // Return single character as a new string
-        const result = try allocator.alloc(u8, 1);
-        result[0] = str_obj.data[@intCast(idx)];
-
-        return createOwned(allocator, result);
+        // Single characters take the inline small-string path
+        const ch = [1]u8{str_obj.data[@intCast(idx)]};
+        return create(allocator, &ch);
     }
 
     pub fn concat(allocator: std.mem.Allocator, a: *PyObject, b: *PyObject) !*PyObject {
@@ -212,3 +284,36 @@ pub fn PyUnicode_AsUTF8AndSize(obj: *PyObject, size: *runtime.Py_ssize_t) callco
     size.* = str_obj.length;
     return str_obj.data;
 }
+
+test "small strings are stored inline" {
+    const allocator = std.testing.allocator;
+
+    // At most SMALL_STRING_MAX bytes: one allocation, data behind header
+    const small = try PyString.create(allocator, "dict_key");
+    defer PyString.deinit(small, allocator);
+    const small_obj: *PyUnicodeObject = @ptrCast(@alignCast(small));
+    try std.testing.expect(small_obj.state & UNICODE_INLINE != 0);
+    try std.testing.expectEqualStrings("dict_key", PyString.getValue(small));
+
+    // Over the limit: separate data allocation as before
+    const big = try PyString.create(allocator, "a string that is definitely longer than twenty-three bytes");
+    defer PyString.deinit(big, allocator);
+    const big_obj: *PyUnicodeObject = @ptrCast(@alignCast(big));
+    try std.testing.expect(big_obj.state & UNICODE_INLINE == 0);
+}
+
+test "interned strings compare by pointer" {
+    const allocator = std.testing.allocator;
+
+    const a = try PyString.intern(allocator, "attribute_name");
+    const b = try PyString.intern(allocator, "attribute_name");
+    try std.testing.expect(a == b);
+    try std.testing.expectEqualStrings("attribute_name", PyString.getValue(a));
+
+    const other = try PyString.intern(allocator, "other_name");
+    try std.testing.expect(a != other);
+
+    // Immortal - deinit is a no-op and the object stays usable
+    PyString.deinit(a, allocator);
+    try std.testing.expectEqualStrings("attribute_name", PyString.getValue(a));
+}
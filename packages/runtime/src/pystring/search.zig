@@ -51,6 +51,91 @@ inline fn getStrData(obj: *PyObject) []const u8 {
     return str_obj.data[0..len];
 }
 
+// =============================================================================
+// Slice-level search engine
+// =============================================================================
+// Shared by the PyString dynamic path below and the static codegen path
+// (which emits calls on raw slices). Short needles use a first/last-byte
+// vector probe so candidate verification only runs where both bytes line
+// up; long needles go through std.mem.indexOfPos, which switches to
+// Boyer-Moore-Horspool and does the skipping there.
+
+const VEC_LEN = 32;
+const SearchVec = @Vector(VEC_LEN, u8);
+const VecMask = std.meta.Int(.unsigned, VEC_LEN);
+
+/// Needles longer than this are left to std's Boyer-Moore-Horspool
+const LONG_NEEDLE_THRESHOLD = 32;
+
+/// Find first occurrence of needle at or after `start` (empty needle
+/// matches at `start`)
+pub fn findBytes(haystack: []const u8, needle: []const u8, start: usize) ?usize {
+    if (needle.len == 0) return if (start <= haystack.len) start else null;
+    if (start >= haystack.len or needle.len > haystack.len - start) return null;
+    if (needle.len == 1) return std.mem.indexOfScalarPos(u8, haystack, start, needle[0]);
+    if (needle.len > LONG_NEEDLE_THRESHOLD) return std.mem.indexOfPos(u8, haystack, start, needle);
+
+    const first: SearchVec = @splat(needle[0]);
+    const last: SearchVec = @splat(needle[needle.len - 1]);
+    const last_offset = needle.len - 1;
+    const last_start = haystack.len - needle.len; // inclusive
+
+    var i = start;
+    // Both vector loads must stay in bounds: the last-byte block reaches
+    // i + last_offset + VEC_LEN
+    while (i + VEC_LEN + last_offset <= haystack.len) : (i += VEC_LEN) {
+        const block_first: SearchVec = haystack[i..][0..VEC_LEN].*;
+        const block_last: SearchVec = haystack[i + last_offset ..][0..VEC_LEN].*;
+        var mask: VecMask = @bitCast((block_first == first) & (block_last == last));
+        while (mask != 0) {
+            const pos = i + @ctz(mask);
+            if (std.mem.eql(u8, haystack[pos .. pos + needle.len], needle)) {
+                return pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    // Scalar tail
+    while (i <= last_start) : (i += 1) {
+        if (haystack[i] == needle[0] and std.mem.eql(u8, haystack[i .. i + needle.len], needle)) {
+            return i;
+        }
+    }
+    return null;
+}
+
+/// Count non-overlapping occurrences of needle (Python str.count semantics;
+/// empty needle counts as 0 here, matching count_substr below)
+pub fn countBytes(haystack: []const u8, needle: []const u8) i64 {
+    if (needle.len == 0 or needle.len > haystack.len) return 0;
+    if (needle.len == 1) return countByte(haystack, needle[0]);
+
+    var total: i64 = 0;
+    var pos: usize = 0;
+    while (findBytes(haystack, needle, pos)) |found| {
+        total += 1;
+        pos = found + needle.len;
+    }
+    return total;
+}
+
+/// Vectorized single-byte count
+fn countByte(haystack: []const u8, c: u8) i64 {
+    const splat: SearchVec = @splat(c);
+    var total: i64 = 0;
+    var i: usize = 0;
+    while (i + VEC_LEN <= haystack.len) : (i += VEC_LEN) {
+        const block: SearchVec = haystack[i..][0..VEC_LEN].*;
+        const mask: VecMask = @bitCast(block == splat);
+        total += @popCount(mask);
+    }
+    for (haystack[i..]) |b| {
+        if (b == c) total += 1;
+    }
+    return total;
+}
+
 pub fn contains(obj: *PyObject, substring: *PyObject) bool {
     std.debug.assert(runtime.PyUnicode_Check(obj));
     std.debug.assert(runtime.PyUnicode_Check(substring));
@@ -61,17 +146,7 @@ pub fn contains(obj: *PyObject, substring: *PyObject) bool {
     // Empty string is always contained
     if (needle.len == 0) return true;
 
-    // Needle longer than haystack
-    if (needle.len > haystack.len) return false;
-
-    // Search for substring
-    var i: usize = 0;
-    while (i <= haystack.len - needle.len) : (i += 1) {
-        if (std.mem.eql(u8, haystack[i .. i + needle.len], needle)) {
-            return true;
-        }
-    }
-    return false;
+    return findBytes(haystack, needle, 0) != null;
 }
 
 pub fn startswith(obj: *PyObject, prefix: *PyObject) bool {
@@ -106,15 +181,8 @@ pub fn find(obj: *PyObject, substring: *PyObject) i64 {
     // Empty string is found at position 0
     if (needle.len == 0) return 0;
 
-    // Needle longer than haystack
-    if (needle.len > haystack.len) return -1;
-
-    // Search for substring
-    var i: usize = 0;
-    while (i <= haystack.len - needle.len) : (i += 1) {
-        if (std.mem.eql(u8, haystack[i .. i + needle.len], needle)) {
-            return @intCast(i);
-        }
+    if (findBytes(haystack, needle, 0)) |pos| {
+        return @intCast(pos);
     }
     return -1;
 }
@@ -126,20 +194,7 @@ pub fn count_substr(obj: *PyObject, substring: *PyObject) i64 {
     const str = getStrData(obj);
     const sub = getStrData(substring);
 
-    if (sub.len == 0) return 0;
-    if (sub.len > str.len) return 0;
-
-    var count_val: i64 = 0;
-    var i: usize = 0;
-    while (i <= str.len - sub.len) {
-        if (std.mem.eql(u8, str[i .. i + sub.len], sub)) {
-            count_val += 1;
-            i += sub.len; // Move past this occurrence
-        } else {
-            i += 1;
-        }
-    }
-    return count_val;
+    return countBytes(str, sub);
 }
 
 pub fn isdigit(obj: *PyObject) bool {
@@ -169,3 +224,29 @@ pub fn isalpha(obj: *PyObject) bool {
     }
     return true;
 }
+
+test "findBytes matches naive search" {
+    const haystack = "GET /api/users HTTP/1.1\r\nHost: example.com\r\nAccept: application/json, text/html\r\n\r\n";
+
+    // Vector path: short needle found past the first block
+    try std.testing.expectEqual(@as(?usize, 25), findBytes(haystack, "Host:", 0));
+    // Candidate with matching first/last byte but different middle
+    try std.testing.expectEqual(@as(?usize, 52), findBytes(haystack, "application", 0));
+    try std.testing.expectEqual(@as(?usize, null), findBytes(haystack, "appliXation", 0));
+    // start offset skips the first hit
+    try std.testing.expectEqual(@as(?usize, null), findBytes(haystack, "Host:", 26));
+    // Long needle (> vector threshold) goes through std's BMH
+    try std.testing.expectEqual(@as(?usize, 44), findBytes(haystack, "Accept: application/json, text/html", 0));
+    // Match in the scalar tail
+    try std.testing.expectEqual(@as(?usize, haystack.len - 4), findBytes(haystack, "\r\n\r\n", 0));
+}
+
+test "countBytes is non-overlapping" {
+    try std.testing.expectEqual(@as(i64, 2), countBytes("aaaaa", "aa"));
+    try std.testing.expectEqual(@as(i64, 3), countBytes("ab ab ab", "ab"));
+    try std.testing.expectEqual(@as(i64, 0), countBytes("short", "longer than haystack"));
+
+    // Single-byte path over more than one vector block
+    const line = "a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z";
+    try std.testing.expectEqual(@as(i64, 25), countBytes(line, ","));
+}
@@ -13,6 +13,22 @@ fn getAllocator() std.mem.Allocator {
     return _allocator orelse std.heap.page_allocator;
 }
 
+/// Shared HTTP client, created on first use. std.http.Client keeps
+/// per-host connections alive in its internal pool, so reusing one
+/// instance gives keep-alive plus one DNS resolve per host instead of
+/// a fresh dial per request. fetch() is safe for concurrent callers.
+var _client: ?std.http.Client = null;
+var _client_mutex: std.Thread.Mutex = .{};
+
+fn getClient() *std.http.Client {
+    _client_mutex.lock();
+    defer _client_mutex.unlock();
+    if (_client == null) {
+        _client = std.http.Client{ .allocator = getAllocator() };
+    }
+    return &_client.?;
+}
+
 /// Response object mimicking Python requests.Response
 pub const Response = struct {
     allocator: std.mem.Allocator,
@@ -55,9 +71,8 @@ pub const Response = struct {
 pub fn get(url: []const u8) !*Response {
     const allocator = getAllocator();
 
-    // Use std.http.Client with Zig 0.15 API
-    var client = std.http.Client{ .allocator = allocator };
-    defer client.deinit();
+    // Pooled client: connections stay open across calls
+    const client = getClient();
 
     // Create allocating writer for response body
     var response_writer = std.Io.Writer.Allocating.init(allocator);
@@ -86,8 +101,7 @@ pub fn get(url: []const u8) !*Response {
 pub fn post(url: []const u8, data: ?[]const u8) !*Response {
     const allocator = getAllocator();
 
-    var client = std.http.Client{ .allocator = allocator };
-    defer client.deinit();
+    const client = getClient();
 
     var response_writer = std.Io.Writer.Allocating.init(allocator);
     defer if (response_writer.writer.buffer.len > 0) allocator.free(response_writer.writer.buffer);
@@ -115,8 +129,7 @@ pub fn post(url: []const u8, data: ?[]const u8) !*Response {
 pub fn put(url: []const u8, data: ?[]const u8) !*Response {
     const allocator = getAllocator();
 
-    var client = std.http.Client{ .allocator = allocator };
-    defer client.deinit();
+    const client = getClient();
 
     var response_writer = std.Io.Writer.Allocating.init(allocator);
     defer if (response_writer.writer.buffer.len > 0) allocator.free(response_writer.writer.buffer);
@@ -144,8 +157,7 @@ pub fn put(url: []const u8, data: ?[]const u8) !*Response {
 pub fn delete(url: []const u8) !*Response {
     const allocator = getAllocator();
 
-    var client = std.http.Client{ .allocator = allocator };
-    defer client.deinit();
+    const client = getClient();
 
     var response_writer = std.Io.Writer.Allocating.init(allocator);
     defer if (response_writer.writer.buffer.len > 0) allocator.free(response_writer.writer.buffer);
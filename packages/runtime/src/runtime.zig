@@ -662,11 +662,26 @@ pub const PyBoolObject = extern struct {
     ob_digit: i64, // 0 for False, 1 for True
 };
 
+/// Storage tag for PyListObject's unboxed mirror (see pylist.zig)
+pub const ListStoreTag = enum(u8) {
+    empty = 0, // no elements observed yet
+    int = 1, // every element is an int; mirror holds i64 values
+    float = 2, // every element is a float; mirror holds f64 values
+    mixed = 3, // heterogeneous or edited in place; no mirror
+};
+
 /// PyListObject - Python list (CPython compatible)
+/// The fields past `allocated` extend the CPython-visible prefix with a
+/// tag-homogeneous fast path: while every element shares one numeric
+/// type, a contiguous unboxed mirror of the values lives beside the
+/// boxed items so reductions scan memory instead of chasing a pointer
+/// per element. Defaults keep existing struct initializers valid.
 pub const PyListObject = extern struct {
     ob_base: PyVarObject,
     ob_item: [*]*PyObject, // Array of PyObject pointers
     allocated: Py_ssize_t, // Allocated capacity
+    store_tag: ListStoreTag = .empty,
+    unboxed: ?[*]i64 = null, // Mirror, capacity == allocated; holds f64 bits for .float
 };
 
 /// PyTupleObject - Python tuple (CPython compatible)
@@ -821,7 +836,7 @@ pub var PyBoolArray_Type: PyTypeObject = makeTypeObject("numpy.ndarray[bool]", @
 // None singleton
 pub var _Py_NoneStruct: PyNoneStruct = .{
     .ob_base = .{
-        .ob_refcnt = 1, // Immortal
+        .ob_refcnt = IMMORTAL_REFCNT,
         .ob_type = &PyNone_Type,
     },
 };
@@ -831,11 +846,18 @@ pub const Py_None: *PyObject = @ptrCast(&_Py_NoneStruct);
 // CPython-compatible Reference Counting Macros
 // =============================================================================
 
+/// Immortal reference count (CPython 3.12-style). Singletons and interned
+/// objects start here; incref/decref skip them so hot loops touching
+/// True/False/None/small ints never dirty the refcount cache line.
+pub const IMMORTAL_REFCNT: Py_ssize_t = std.math.maxInt(i32);
+
 pub inline fn Py_INCREF(op: *PyObject) void {
+    if (op.ob_refcnt >= IMMORTAL_REFCNT) return;
     op.ob_refcnt += 1;
 }
 
 pub inline fn Py_DECREF(op: *PyObject) void {
+    if (op.ob_refcnt >= IMMORTAL_REFCNT) return;
     op.ob_refcnt -= 1;
     if (op.ob_refcnt == 0) {
         if (op.ob_type.tp_dealloc) |dealloc| {
@@ -956,6 +978,7 @@ pub fn incref(obj: *PyObject) void {
 
 /// Legacy decref with allocator - uses new type-based deallocation
 pub fn decref(obj: *PyObject, allocator: std.mem.Allocator) void {
+    if (obj.ob_refcnt >= IMMORTAL_REFCNT) return;
     if (obj.ob_refcnt <= 0) {
         std.debug.print("WARNING: Attempting to decref object with ref_count already 0\n", .{});
         return;
@@ -990,6 +1013,9 @@ pub fn decref(obj: *PyObject, allocator: std.mem.Allocator) void {
                     const alloc_size: usize = @intCast(list_obj.allocated);
                     allocator.free(list_obj.ob_item[0..alloc_size]);
                 }
+                // Homogeneous lists carry an unboxed mirror on its own
+                // allocator; release it with the boxed storage
+                pylist.PyList.freeMirror(list_obj);
                 allocator.destroy(list_obj);
             },
             .tuple => {
@@ -1004,13 +1030,9 @@ pub fn decref(obj: *PyObject, allocator: std.mem.Allocator) void {
                 allocator.destroy(tuple_obj);
             },
             .string => {
-                const str_obj: *PyUnicodeObject = @ptrCast(@alignCast(obj));
-                // Free the string data if owned
-                const len: usize = @intCast(str_obj.length);
-                if (len > 0) {
-                    allocator.free(str_obj.data[0..len]);
-                }
-                allocator.destroy(str_obj);
+                // Layout-aware free: inline small strings are one block,
+                // interned strings are immortal and never freed
+                pystring.PyString.deinit(obj, allocator);
             },
             .dict => {
                 const dict_obj: *PyDictObject = @ptrCast(@alignCast(obj));
@@ -1417,6 +1439,7 @@ pub const hashlib = @import("hashlib.zig");
 pub const pickle = @import("pickle.zig");
 pub const test_support = @import("test_support.zig");
 pub const base64 = @import("base64.zig");
+pub const profiler = @import("profiler.zig");
 pub const pylong = @import("pylong.zig");
 
 // Green thread runtime (real M:N scheduler)
@@ -1,5 +1,6 @@
 const std = @import("std");
 const GreenThread = @import("green_thread").GreenThread;
+const StackPool = @import("green_thread").StackPool;
 const WorkQueue = @import("work_queue").WorkQueue;
 
 pub const Scheduler = struct {
@@ -10,6 +11,7 @@ pub const Scheduler = struct {
     active_threads: std.atomic.Value(usize),
     shutdown_flag: std.atomic.Value(bool),
     num_workers: usize,
+    stack_pool: StackPool,
 
     pub fn init(allocator: std.mem.Allocator, num_threads: usize) !Scheduler {
         const thread_count = if (num_threads == 0)
@@ -35,6 +37,7 @@ pub const Scheduler = struct {
             .active_threads = std.atomic.Value(usize).init(0),
             .shutdown_flag = std.atomic.Value(bool).init(false),
             .num_workers = thread_count,
+            .stack_pool = .{},
         };
     }
 
@@ -65,6 +68,7 @@ pub const Scheduler = struct {
         }
         self.allocator.free(self.queues);
         self.allocator.free(self.workers);
+        self.stack_pool.deinit();
     }
 
     /// Simple spawn for compatibility with legacy API (function takes *GreenThread)
@@ -80,7 +84,7 @@ pub const Scheduler = struct {
             }
         };
 
-        const thread = try GreenThread.init(self.allocator, id, Wrapper.call, null, null);
+        const thread = try GreenThread.initPooled(self.allocator, &self.stack_pool, id, Wrapper.call, null, null);
         thread.result = @ptrCast(&func);
 
         // Round-robin assignment to queues
@@ -146,8 +150,10 @@ pub const Scheduler = struct {
         const id = self.next_id.fetchAdd(1, .monotonic);
 
         // Create thread first so we can pass it to the wrapper
-        const thread = try GreenThread.init(
+        // (stack comes from the pool, so spawn stays allocation-light)
+        const thread = try GreenThread.initPooled(
             self.allocator,
+            &self.stack_pool,
             id,
             Wrapper.call,
             null, // Will set user_context after creating wrapper
@@ -221,7 +227,7 @@ pub const Scheduler = struct {
 
         // Create GreenThread with wrapper, context, and cleanup
         const id = self.next_id.fetchAdd(1, .monotonic);
-        const thread = try GreenThread.init(self.allocator, id, Gen.wrapper, @ptrCast(ctx), Gen.cleanup);
+        const thread = try GreenThread.initPooled(self.allocator, &self.stack_pool, id, Gen.wrapper, @ptrCast(ctx), Gen.cleanup);
 
         // Round-robin assignment to queues
         const queue_idx = @as(usize, @intCast(id % self.num_workers));
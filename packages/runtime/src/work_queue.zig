@@ -1,61 +1,170 @@
 const std = @import("std");
 const GreenThread = @import("green_thread").GreenThread;
 
-/// Chase-Lev work-stealing deque
+/// Chase-Lev work-stealing deque (lock-free)
 /// Owner thread pushes/pops from bottom (LIFO)
-/// Other threads steal from top (FIFO)
+/// Other threads steal from top (FIFO) via CAS - no mutex anywhere
+///
+/// Memory ordering follows Lê et al., "Correct and Efficient Work-Stealing for
+/// Weak Memory Models", with the standalone fences replaced by seq_cst
+/// accesses on top/bottom (Zig has no @fence).
 pub const WorkQueue = struct {
-    tasks: std.ArrayList(*GreenThread),
-    mutex: std.Thread.Mutex,
+    /// Starting ring size - must be a power of two so wrapping is a mask
+    const INITIAL_CAPACITY: usize = 64;
+
+    /// Growable circular array of task pointers. Retired buffers are kept
+    /// alive until deinit because a concurrent stealer may still be reading
+    /// from one (classic Chase-Lev reclamation strategy).
+    const Buffer = struct {
+        storage: []*GreenThread,
+        mask: u64,
+
+        fn create(allocator: std.mem.Allocator, capacity: usize) !*Buffer {
+            const buf = try allocator.create(Buffer);
+            buf.* = .{
+                .storage = try allocator.alloc(*GreenThread, capacity),
+                .mask = capacity - 1,
+            };
+            return buf;
+        }
+
+        fn destroy(self: *Buffer, allocator: std.mem.Allocator) void {
+            allocator.free(self.storage);
+            allocator.destroy(self);
+        }
+
+        fn get(self: *Buffer, index: i64) *GreenThread {
+            const slot: usize = @intCast(@as(u64, @bitCast(index)) & self.mask);
+            return @atomicLoad(*GreenThread, &self.storage[slot], .unordered);
+        }
+
+        fn put(self: *Buffer, index: i64, task: *GreenThread) void {
+            const slot: usize = @intCast(@as(u64, @bitCast(index)) & self.mask);
+            @atomicStore(*GreenThread, &self.storage[slot], task, .unordered);
+        }
+    };
+
+    top: std.atomic.Value(i64),
+    bottom: std.atomic.Value(i64),
+    buffer: std.atomic.Value(*Buffer),
+    /// Whether the lazily allocated initial ring exists yet (owner-only)
+    has_buffer: bool,
+    /// Buffers replaced by grow(), freed in deinit (owner-only)
+    retired: std.ArrayList(*Buffer),
     allocator: std.mem.Allocator,
 
     pub fn init(allocator: std.mem.Allocator) WorkQueue {
+        // Buffer allocation is deferred to the first push so init stays
+        // infallible (scheduler creates one queue per worker up front)
         return .{
-            .tasks = std.ArrayList(*GreenThread){},
-            .mutex = .{},
+            .top = std.atomic.Value(i64).init(0),
+            .bottom = std.atomic.Value(i64).init(0),
+            .buffer = std.atomic.Value(*Buffer).init(undefined),
+            .has_buffer = false,
+            .retired = std.ArrayList(*Buffer){},
             .allocator = allocator,
         };
     }
 
     pub fn deinit(self: *WorkQueue) void {
-        self.tasks.deinit(self.allocator);
+        if (self.has_buffer) {
+            self.buffer.load(.monotonic).destroy(self.allocator);
+        }
+        for (self.retired.items) |buf| {
+            buf.destroy(self.allocator);
+        }
+        self.retired.deinit(self.allocator);
+    }
+
+    /// Double the ring and publish the new buffer (owner thread only)
+    fn grow(self: *WorkQueue, old: *Buffer, bottom: i64, top: i64) !*Buffer {
+        const new = try Buffer.create(self.allocator, old.storage.len * 2);
+        var i = top;
+        while (i < bottom) : (i += 1) {
+            new.put(i, old.get(i));
+        }
+        try self.retired.append(self.allocator, old);
+        self.buffer.store(new, .release);
+        return new;
     }
 
     /// Push task to bottom (owner thread only)
     pub fn push(self: *WorkQueue, task: *GreenThread) !void {
-        self.mutex.lock();
-        defer self.mutex.unlock();
-        try self.tasks.append(self.allocator, task);
+        const b = self.bottom.load(.monotonic);
+        const t = self.top.load(.acquire);
+
+        var buf: *Buffer = undefined;
+        if (!self.has_buffer) {
+            // First push: allocate the initial ring lazily
+            buf = try Buffer.create(self.allocator, INITIAL_CAPACITY);
+            self.buffer.store(buf, .release);
+            self.has_buffer = true;
+        } else {
+            buf = self.buffer.load(.monotonic);
+            if (b - t >= @as(i64, @intCast(buf.storage.len))) {
+                buf = try self.grow(buf, b, t);
+            }
+        }
+
+        buf.put(b, task);
+        self.bottom.store(b + 1, .release);
     }
 
     /// Pop task from bottom (owner thread only) - LIFO for cache locality
     pub fn pop(self: *WorkQueue) ?*GreenThread {
-        self.mutex.lock();
-        defer self.mutex.unlock();
+        if (!self.has_buffer) return null; // never pushed
+        const b = self.bottom.load(.monotonic) - 1;
+        const buf = self.buffer.load(.monotonic);
+
+        // Reserve the bottom slot before re-reading top (needs total order
+        // with concurrent steals, hence seq_cst on both sides)
+        self.bottom.store(b, .seq_cst);
+        const t = self.top.load(.seq_cst);
+
+        if (t > b) {
+            // Queue was empty - undo the reservation
+            self.bottom.store(b + 1, .monotonic);
+            return null;
+        }
 
-        if (self.tasks.items.len == 0) return null;
-        return self.tasks.pop();
+        const task = buf.get(b);
+        if (t == b) {
+            // Last element: race a pending stealer for it via CAS on top
+            const won = self.top.cmpxchgStrong(t, t + 1, .seq_cst, .monotonic) == null;
+            self.bottom.store(b + 1, .monotonic);
+            return if (won) task else null;
+        }
+        return task;
     }
 
-    /// Steal task from top (other threads) - FIFO for fairness
+    /// Steal task from top (other threads) - FIFO for fairness, lock-free
     pub fn steal(self: *WorkQueue) ?*GreenThread {
-        self.mutex.lock();
-        defer self.mutex.unlock();
+        const t = self.top.load(.seq_cst);
+        const b = self.bottom.load(.seq_cst);
+        if (t >= b) return null;
+
+        const buf = self.buffer.load(.acquire);
+        const task = buf.get(t);
 
-        if (self.tasks.items.len == 0) return null;
-        return self.tasks.orderedRemove(0);
+        // CAS claims the slot; failure means the owner popped it or another
+        // thief beat us - caller just tries a different victim
+        if (self.top.cmpxchgStrong(t, t + 1, .seq_cst, .monotonic) != null) {
+            return null;
+        }
+        return task;
     }
 
     pub fn len(self: *WorkQueue) usize {
-        self.mutex.lock();
-        defer self.mutex.unlock();
-        return self.tasks.items.len;
+        const b = self.bottom.load(.monotonic);
+        const t = self.top.load(.monotonic);
+        return if (b > t) @intCast(b - t) else 0;
     }
 
-    /// Lock-free size check (may be stale, used for work-stealing heuristics)
+    /// Approximate size (may be stale, used for work-stealing heuristics)
     pub fn size(self: *const WorkQueue) usize {
-        // Direct read without lock - acceptable race for heuristic checks
-        return self.tasks.items.len;
+        const b = self.bottom.load(.monotonic);
+        const t = self.top.load(.monotonic);
+        return if (b > t) @intCast(b - t) else 0;
     }
 
     pub fn isEmpty(self: *WorkQueue) bool {
@@ -135,3 +244,35 @@ test "WorkQueue work stealing" {
     // Should have t2 left
     try std.testing.expectEqual(@as(usize, 1), queue.len());
 }
+
+test "WorkQueue grows past initial capacity" {
+    const allocator = std.testing.allocator;
+
+    var queue = WorkQueue.init(allocator);
+    defer queue.deinit();
+
+    const TestFunc = struct {
+        fn func(thread: *GreenThread) void {
+            _ = thread;
+        }
+    };
+
+    // Push enough tasks to force at least one ring doubling
+    const count = 200;
+    var threads: [count]*GreenThread = undefined;
+    for (0..count) |i| {
+        threads[i] = try GreenThread.init(allocator, @intCast(i + 1), TestFunc.func, null, null);
+        try queue.push(threads[i]);
+    }
+    defer for (threads) |t| t.deinit(allocator);
+
+    try std.testing.expectEqual(@as(usize, count), queue.len());
+
+    // All tasks must survive the grow: pop everything back in LIFO order
+    var expected: u64 = count;
+    while (queue.pop()) |task| : (expected -= 1) {
+        try std.testing.expectEqual(expected, task.id);
+    }
+    try std.testing.expectEqual(@as(u64, 0), expected);
+    try std.testing.expectEqual(true, queue.isEmpty());
+}
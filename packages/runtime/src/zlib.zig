@@ -75,8 +75,7 @@ pub fn compressWithAllocator(allocator: std.mem.Allocator, data: []const u8, lev
     );
 
     if (compressed_size == 0) {
-        allocator.free(output);
-        return ZlibError.CompressionError;
+        return ZlibError.CompressionError; // errdefer frees output
     }
 
     // Resize to actual size
@@ -89,7 +88,17 @@ pub fn decompress(data: []const u8, bufsize: usize) ![]u8 {
 }
 
 /// Decompress with custom allocator
+/// Fast path: libdeflate whole-buffer decompress; falls back to streaming
+/// inflate for streams libdeflate rejects
 pub fn decompressWithAllocator(allocator: std.mem.Allocator, data: []const u8, bufsize: usize) ![]u8 {
+    return decompressLibdeflate(allocator, data, bufsize) catch |err| switch (err) {
+        ZlibError.DecompressionError => decompressStreaming(allocator, data),
+        else => err,
+    };
+}
+
+/// Whole-buffer decompress via libdeflate (grows the output on demand)
+fn decompressLibdeflate(allocator: std.mem.Allocator, data: []const u8, bufsize: usize) ![]u8 {
     // Create decompressor
     const decompressor = c.libdeflate_alloc_decompressor() orelse return ZlibError.OutOfMemory;
     defer c.libdeflate_free_decompressor(decompressor);
@@ -119,14 +128,23 @@ pub fn decompressWithAllocator(allocator: std.mem.Allocator, data: []const u8, b
                 output_size *= 2;
                 output = try allocator.realloc(output, output_size);
             },
-            else => {
-                allocator.free(output);
-                return ZlibError.DecompressionError;
-            },
+            else => return ZlibError.DecompressionError, // errdefer frees output
         }
     }
 }
 
+/// Streaming fallback: generic inflate via std.compress.flate.
+/// Slower than libdeflate but accepts any valid zlib stream.
+fn decompressStreaming(allocator: std.mem.Allocator, data: []const u8) ![]u8 {
+    var in: std.Io.Reader = .fixed(data);
+    var window: [std.compress.flate.max_window_len]u8 = undefined;
+    var inflate: std.compress.flate.Decompress = .init(&in, .zlib, &window);
+    return inflate.reader.allocRemaining(allocator, .unlimited) catch |err| switch (err) {
+        error.OutOfMemory => ZlibError.OutOfMemory,
+        else => ZlibError.DecompressionError,
+    };
+}
+
 /// Calculate CRC32 checksum
 pub fn crc32(data: []const u8, value: u32) u32 {
     return @intCast(c.libdeflate_crc32(@intCast(value), data.ptr, data.len));
@@ -15,6 +15,7 @@ const cl100k_splitter = @import("cl100k_splitter.zig");
 const AhoCorasick = @import("aho_corasick.zig").AhoCorasick;
 const LruCache = @import("lru_cache.zig").LruCache;
 const tokenizer_io = @import("tokenizer_io.zig");
+const vocab_cache = @import("vocab_cache.zig");
 
 /// Select best allocator for encode_arena based on target platform
 /// Native: c_allocator (jemalloc - 2x faster, zero syscalls)
@@ -75,6 +76,7 @@ pub const Tokenizer = struct {
     next_prefix_match: []u32, // Precomputed next_prefix table (rs-bpe optimization)
     allocator: Allocator,
     encode_arena: std.heap.ArenaAllocator, // Reused across encode() calls - eliminates 116,600 syscalls
+    mapped_vocab: ?vocab_cache.MappedVocab = null, // Set by initFromVocabCache: token bytes live in the mapping
 
     pub fn initFromData(json_data: []const u8, allocator: Allocator) !Tokenizer {
         const data = try parser.initFromData(json_data, allocator);
@@ -110,18 +112,69 @@ pub const Tokenizer = struct {
         };
     }
 
-    pub fn deinit(self: *Tokenizer) void {
-        var vocab_it = self.vocab.iterator();
-        while (vocab_it.next()) |entry| {
-            self.allocator.free(entry.key_ptr.*);
+    /// Initialize from an AOT-compiled vocabulary cache (see vocab_cache.zig).
+    /// Skips JSON parsing and base64 decoding entirely: token bytes stay in
+    /// the mmap'd file and the hash tables hold slices into it. Compile the
+    /// cache once with vocab_cache.compileFromJsonFile().
+    pub fn initFromVocabCache(cache_path: []const u8, allocator: Allocator) !Tokenizer {
+        var mapped = try vocab_cache.MappedVocab.init(cache_path);
+        errdefer mapped.deinit();
+
+        var vocab = std.HashMap([]const u8, u32, FnvHashContext([]const u8), std.hash_map.default_max_load_percentage).initContext(allocator, FnvHashContext([]const u8){});
+        errdefer vocab.deinit();
+        try vocab.ensureTotalCapacity(mapped.token_count);
+
+        var vocab_r = std.AutoHashMap(u32, []const u8).init(allocator);
+        errdefer vocab_r.deinit();
+        try vocab_r.ensureTotalCapacity(mapped.token_count);
+
+        var rank: u32 = 0;
+        while (rank < mapped.token_count) : (rank += 1) {
+            const token = mapped.getToken(rank) orelse continue;
+            vocab.putAssumeCapacity(token, rank);
+            vocab_r.putAssumeCapacity(rank, token);
         }
-        self.vocab.deinit();
 
-        // Free vocab_r values (owned strings)
-        var vocab_r_it = self.vocab_r.valueIterator();
-        while (vocab_r_it.next()) |value| {
-            self.allocator.free(value.*);
+        var merges_map = std.HashMap(Pair, u32, FnvHashContext(Pair), std.hash_map.default_max_load_percentage).initContext(allocator, FnvHashContext(Pair){});
+        errdefer merges_map.deinit();
+
+        const split_table = try buildSplitTable(&vocab_r, &vocab, &merges_map, allocator);
+        const aho_corasick = try buildAhoCorasick(&vocab_r, allocator);
+        const next_prefix_match = try buildNextPrefixMatch(&vocab_r, aho_corasick.?, allocator);
+        const pattern_str = try allocator.dupe(u8, "'s|'t|'re|'ve|'m|'ll|'d| ?[[:alpha:]]+| ?[[:digit:]]+| ?[^[:alnum:][:space:]]+| +[[:space:]]*| +");
+
+        return Tokenizer{
+            .vocab = vocab,
+            .vocab_r = vocab_r,
+            .merges = std.ArrayList(Pair){},
+            .merges_map = merges_map,
+            .split_table = split_table,
+            .pattern_str = pattern_str,
+            .trie = null,
+            .aho_corasick = aho_corasick,
+            .next_prefix_match = next_prefix_match,
+            .allocator = allocator,
+            .encode_arena = std.heap.ArenaAllocator.init(getBestArenaAllocator(allocator)),
+            .mapped_vocab = mapped,
+        };
+    }
+
+    pub fn deinit(self: *Tokenizer) void {
+        // Mapped vocabularies borrow token bytes from the mmap region;
+        // heap vocabularies own them
+        if (self.mapped_vocab == null) {
+            var vocab_it = self.vocab.iterator();
+            while (vocab_it.next()) |entry| {
+                self.allocator.free(entry.key_ptr.*);
+            }
+
+            // Free vocab_r values (owned strings)
+            var vocab_r_it = self.vocab_r.valueIterator();
+            while (vocab_r_it.next()) |value| {
+                self.allocator.free(value.*);
+            }
         }
+        self.vocab.deinit();
         self.vocab_r.deinit();
 
         self.merges.deinit(self.allocator);
@@ -132,6 +185,7 @@ pub const Tokenizer = struct {
         if (self.aho_corasick) |*ac| ac.deinit();
         self.allocator.free(self.next_prefix_match);
         self.encode_arena.deinit();
+        if (self.mapped_vocab) |*mapped| mapped.deinit();
     }
 
     /// HASH MAP optimization: O(n * k) instead of O(n * m)
@@ -468,6 +522,137 @@ pub const Tokenizer = struct {
         return tokens;
     }
 
+    /// Batch encoding configuration
+    pub const BatchConfig = struct {
+        num_threads: usize = 0, // 0 = CPU count
+        min_parallel_bytes: usize = 64 * 1024, // below this, single-threaded
+    };
+
+    /// Encode a large document across multiple threads (tiktoken/Rayon style).
+    ///
+    /// Splits the input on pretoken boundaries so every worker sees exactly
+    /// the chunks a sequential encode() would, fans the slices out over
+    /// std.Thread workers (each with its own arena), and stitches token ids
+    /// back together in input order.
+    ///
+    /// Unlike encode(), the returned slice is allocated from `allocator` and
+    /// owned by the caller - free it with allocator.free(). The shared vocab
+    /// tables are only read; `self.allocator` must be thread-safe (GPA and
+    /// c_allocator both are) because worker threads populate their
+    /// thread-local chunk caches through it.
+    pub fn encodeBatch(self: *Tokenizer, allocator: Allocator, text: []const u8, config: BatchConfig) ![]u32 {
+        const builtin = @import("builtin");
+        const cpu_count = if (config.num_threads == 0)
+            std.Thread.getCpuCount() catch 1
+        else
+            config.num_threads;
+        const want_threads = @min(cpu_count, @max(text.len / config.min_parallel_bytes, 1));
+
+        if (want_threads <= 1 or builtin.cpu.arch.isWasm()) {
+            const tokens = try self.encode(text);
+            return allocator.dupe(u32, tokens);
+        }
+
+        // Slice boundaries must be pretoken starts, or workers would merge
+        // across a split the sequential encoder never sees. One cheap
+        // splitter pass finds them; BPE itself dominates the cost.
+        const boundaries = try allocator.alloc(usize, want_threads + 1);
+        defer allocator.free(boundaries);
+        const num_slices = computeSliceBoundaries(text, want_threads, boundaries);
+        if (num_slices <= 1) {
+            const tokens = try self.encode(text);
+            return allocator.dupe(u32, tokens);
+        }
+
+        const workers = try allocator.alloc(BatchWorker, num_slices);
+        defer allocator.free(workers);
+        const threads = try allocator.alloc(std.Thread, num_slices);
+        defer allocator.free(threads);
+
+        for (workers, 0..) |*worker, i| {
+            worker.* = .{
+                .tokenizer = self,
+                .slice = text[boundaries[i]..boundaries[i + 1]],
+                .arena = std.heap.ArenaAllocator.init(getBestArenaAllocator(allocator)),
+            };
+        }
+        defer for (workers) |*worker| worker.arena.deinit();
+
+        for (threads, 0..) |*thread, i| {
+            thread.* = std.Thread.spawn(.{}, BatchWorker.run, .{&workers[i]}) catch |err| {
+                // The defers above free workers and their arenas; wait for
+                // the threads already running against them first
+                for (threads[0..i]) |running| running.join();
+                return err;
+            };
+        }
+        for (threads) |thread| thread.join();
+
+        var total: usize = 0;
+        for (workers) |*worker| {
+            if (worker.err) |err| return err;
+            total += worker.tokens.items.len;
+        }
+
+        // Stitch worker outputs back in input order
+        const result = try allocator.alloc(u32, total);
+        errdefer allocator.free(result);
+        var offset: usize = 0;
+        for (workers) |*worker| {
+            @memcpy(result[offset .. offset + worker.tokens.items.len], worker.tokens.items);
+            offset += worker.tokens.items.len;
+        }
+        return result;
+    }
+
+    const BatchWorker = struct {
+        tokenizer: *Tokenizer,
+        slice: []const u8,
+        arena: std.heap.ArenaAllocator,
+        tokens: std.ArrayList(u32) = .{},
+        err: ?anyerror = null,
+
+        fn run(self: *BatchWorker) void {
+            self.encodeSlice() catch |err| {
+                self.err = err;
+            };
+        }
+
+        fn encodeSlice(self: *BatchWorker) !void {
+            const arena = self.arena.allocator();
+            try self.tokens.ensureTotalCapacity(arena, self.slice.len / 2);
+
+            var chunk_iter = cl100k_splitter.chunks(self.slice);
+            while (chunk_iter.next()) |chunk| {
+                const chunk_tokens = try self.tokenizer.encodeViaBacktrackingArena(chunk, arena);
+                try self.tokens.appendSlice(arena, chunk_tokens);
+            }
+        }
+    };
+
+    /// Split text into up to `max_slices` contiguous slices whose edges all
+    /// fall on pretoken boundaries. Writes slice offsets into `boundaries`
+    /// (needs max_slices + 1 entries) and returns the slice count.
+    fn computeSliceBoundaries(text: []const u8, max_slices: usize, boundaries: []usize) usize {
+        boundaries[0] = 0;
+        var num_slices: usize = 1;
+
+        var chunk_iter = cl100k_splitter.chunks(text);
+        while (chunk_iter.next()) |chunk| {
+            if (num_slices >= max_slices) break;
+            const start = @intFromPtr(chunk.ptr) - @intFromPtr(text.ptr);
+            // Next boundary target: even byte split, snapped forward to the
+            // first pretoken start at or past it
+            if (start >= num_slices * text.len / max_slices and start > boundaries[num_slices - 1]) {
+                boundaries[num_slices] = start;
+                num_slices += 1;
+            }
+        }
+
+        boundaries[num_slices] = text.len;
+        return num_slices;
+    }
+
     /// Decode token IDs back to text
     pub fn decode(self: *Tokenizer, tokens: []const u32) ![]u8 {
         return tokenizer_io.decode(self, tokens);
@@ -487,6 +672,30 @@ test "SIMD pair counting" {
     try std.testing.expectEqual(@as(u32, 3), count);
 }
 
+test "batch slice boundaries fall on pretoken starts" {
+    const text = "The quick brown fox jumps over the lazy dog. " ** 8;
+    var boundaries: [5]usize = undefined;
+    const num_slices = Tokenizer.computeSliceBoundaries(text, 4, &boundaries);
+
+    try std.testing.expect(num_slices >= 2);
+    try std.testing.expectEqual(@as(usize, 0), boundaries[0]);
+    try std.testing.expectEqual(text.len, boundaries[num_slices]);
+
+    // Every boundary must be a chunk start the sequential splitter produces
+    for (boundaries[1..num_slices]) |boundary| {
+        var found = false;
+        var chunk_iter = cl100k_splitter.chunks(text);
+        while (chunk_iter.next()) |chunk| {
+            const start = @intFromPtr(chunk.ptr) - @intFromPtr(text.ptr);
+            if (start == boundary) {
+                found = true;
+                break;
+            }
+        }
+        try std.testing.expect(found);
+    }
+}
+
 test "pair merging" {
     var arena = std.heap.ArenaAllocator.init(std.testing.allocator);
     defer arena.deinit();
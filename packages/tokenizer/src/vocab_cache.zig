@@ -0,0 +1,262 @@
+//! Ahead-of-time compiled vocabulary cache - mmap'd, used in place
+//!
+//! Loading an hf_32k.json-style vocabulary parses JSON, base64-decodes every
+//! token and heap-copies it on each process start. This module compiles the
+//! vocabulary once into a flat, offset-based binary file that is then
+//! memory-mapped read-only and queried in place: token bytes live in the
+//! mapping, ranks come from a precomputed open-addressed index baked into
+//! the file, so no per-token work happens at startup.
+//!
+//! File layout (all fields little-endian, 4-byte aligned; the cache is a
+//! machine-local artifact regenerated from JSON, not an interchange format):
+//!
+//!   Header   magic "M0VC", version, token_count, index_cap, blob_len
+//!   offsets  [token_count + 1]u32   byte offsets into blob, rank-ordered
+//!   index    [index_cap]u32         open-addressed rank slots, EMPTY_SLOT
+//!                                   when unused; index_cap is a power of
+//!                                   two sized for <= 50% load
+//!   blob     [blob_len]u8           token bytes concatenated by rank
+
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const FnvHashContext = @import("fnv_hash.zig").FnvHashContext;
+
+const MAGIC = [4]u8{ 'M', '0', 'V', 'C' };
+const VERSION: u32 = 1;
+const EMPTY_SLOT: u32 = std.math.maxInt(u32);
+
+const Header = extern struct {
+    magic: [4]u8,
+    version: u32,
+    token_count: u32,
+    index_cap: u32,
+    blob_len: u32,
+};
+
+/// Read-only view over an mmap'd vocabulary cache file
+pub const MappedVocab = struct {
+    mapped: []align(std.heap.page_size_min) u8,
+    token_count: u32,
+    offsets: []const u32,
+    index: []const u32,
+    blob: []const u8,
+
+    pub fn init(path: []const u8) !MappedVocab {
+        const file = if (std.fs.path.isAbsolute(path))
+            try std.fs.openFileAbsolute(path, .{})
+        else
+            try std.fs.cwd().openFile(path, .{});
+        defer file.close();
+
+        const size = (try file.stat()).size;
+        if (size < @sizeOf(Header)) return error.InvalidVocabCache;
+
+        const region = try std.posix.mmap(
+            null,
+            size,
+            std.posix.PROT.READ,
+            .{ .TYPE = .PRIVATE },
+            file.handle,
+            0,
+        );
+        errdefer std.posix.munmap(region);
+
+        const header = std.mem.bytesAsValue(Header, region[0..@sizeOf(Header)]);
+        if (!std.mem.eql(u8, &header.magic, &MAGIC)) return error.InvalidVocabCache;
+        if (header.version != VERSION) return error.UnsupportedVocabCacheVersion;
+        if (!std.math.isPowerOfTwo(header.index_cap)) return error.InvalidVocabCache;
+
+        const offsets_len = @as(usize, header.token_count) + 1;
+        const offsets_end = @sizeOf(Header) + offsets_len * @sizeOf(u32);
+        const index_end = offsets_end + @as(usize, header.index_cap) * @sizeOf(u32);
+        if (index_end + header.blob_len > size) return error.InvalidVocabCache;
+
+        return .{
+            .mapped = region,
+            .token_count = header.token_count,
+            .offsets = @alignCast(std.mem.bytesAsSlice(u32, region[@sizeOf(Header)..offsets_end])),
+            .index = @alignCast(std.mem.bytesAsSlice(u32, region[offsets_end..index_end])),
+            .blob = region[index_end .. index_end + header.blob_len],
+        };
+    }
+
+    pub fn deinit(self: *MappedVocab) void {
+        std.posix.munmap(self.mapped);
+    }
+
+    /// Token bytes for a rank - a slice into the mapping, valid until deinit
+    pub fn getToken(self: *const MappedVocab, rank: u32) ?[]const u8 {
+        if (rank >= self.token_count) return null;
+        const token = self.blob[self.offsets[rank]..self.offsets[rank + 1]];
+        if (token.len == 0) return null; // gap in a sparse rank space
+        return token;
+    }
+
+    /// Rank for token bytes, probing the precomputed index in place
+    pub fn getRank(self: *const MappedVocab, token: []const u8) ?u32 {
+        if (token.len == 0 or self.index.len == 0) return null;
+        const mask = self.index.len - 1;
+        var slot = FnvHashContext([]const u8).hash(.{}, token) & mask;
+        while (self.index[slot] != EMPTY_SLOT) : (slot = (slot + 1) & mask) {
+            const rank = self.index[slot];
+            const candidate = self.blob[self.offsets[rank]..self.offsets[rank + 1]];
+            if (std.mem.eql(u8, candidate, token)) return rank;
+        }
+        return null;
+    }
+};
+
+/// Write a cache file for tokens ordered by rank (index == rank). Zero-length
+/// entries mark gaps in a sparse rank space.
+pub fn writeFile(allocator: Allocator, out_path: []const u8, tokens: []const []const u8) !void {
+    var blob_len: usize = 0;
+    var present: u32 = 0;
+    for (tokens) |token| {
+        blob_len += token.len;
+        if (token.len > 0) present += 1;
+    }
+    if (blob_len > std.math.maxInt(u32)) return error.VocabTooLarge;
+
+    const index_cap = try std.math.ceilPowerOfTwo(u32, @max(present * 2, 8));
+    const mask = index_cap - 1;
+
+    const offsets = try allocator.alloc(u32, tokens.len + 1);
+    defer allocator.free(offsets);
+    const index = try allocator.alloc(u32, index_cap);
+    defer allocator.free(index);
+    @memset(index, EMPTY_SLOT);
+
+    var offset: u32 = 0;
+    for (tokens, 0..) |token, rank| {
+        offsets[rank] = offset;
+        offset += @intCast(token.len);
+        if (token.len == 0) continue;
+        var slot = FnvHashContext([]const u8).hash(.{}, token) & mask;
+        while (index[slot] != EMPTY_SLOT) : (slot = (slot + 1) & mask) {}
+        index[slot] = @intCast(rank);
+    }
+    offsets[tokens.len] = offset;
+
+    const file = if (std.fs.path.isAbsolute(out_path))
+        try std.fs.createFileAbsolute(out_path, .{})
+    else
+        try std.fs.cwd().createFile(out_path, .{});
+    defer file.close();
+
+    const header = Header{
+        .magic = MAGIC,
+        .version = VERSION,
+        .token_count = @intCast(tokens.len),
+        .index_cap = index_cap,
+        .blob_len = offset,
+    };
+    try file.writeAll(std.mem.asBytes(&header));
+    try file.writeAll(std.mem.sliceAsBytes(offsets));
+    try file.writeAll(std.mem.sliceAsBytes(index));
+    for (tokens) |token| {
+        try file.writeAll(token);
+    }
+}
+
+/// Compile an hf-style JSON vocabulary ({"vocab": {"base64": rank, ...}})
+/// into a cache file. Done once offline; startups then mmap the result.
+/// std.json is plenty here - this never runs on the hot path.
+pub fn compileFromJsonFile(allocator: Allocator, json_path: []const u8, out_path: []const u8) !void {
+    var arena_state = std.heap.ArenaAllocator.init(allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const file = try std.fs.cwd().openFile(json_path, .{});
+    defer file.close();
+    const json_data = try file.readToEndAlloc(arena, 1024 * 1024 * 1024);
+
+    const parsed = try std.json.parseFromSliceLeaky(std.json.Value, arena, json_data, .{});
+    if (parsed != .object) return error.InvalidJson;
+    const vocab_value = parsed.object.get("vocab") orelse return error.MissingVocab;
+    if (vocab_value != .object) return error.InvalidJson;
+
+    // First pass: find the rank space so sparse vocabularies keep gaps
+    var max_rank: u32 = 0;
+    var it = vocab_value.object.iterator();
+    while (it.next()) |entry| {
+        if (entry.value_ptr.* != .integer) return error.InvalidJson;
+        max_rank = @max(max_rank, @as(u32, @intCast(entry.value_ptr.integer)));
+    }
+
+    const tokens = try arena.alloc([]const u8, @as(usize, max_rank) + 1);
+    @memset(tokens, &.{});
+
+    const decoder = std.base64.standard.Decoder;
+    it = vocab_value.object.iterator();
+    while (it.next()) |entry| {
+        const rank = @as(u32, @intCast(entry.value_ptr.integer));
+        const decoded_size = try decoder.calcSizeForSlice(entry.key_ptr.*);
+        const token = try arena.alloc(u8, decoded_size);
+        try decoder.decode(token, entry.key_ptr.*);
+        tokens[rank] = token;
+    }
+
+    try writeFile(allocator, out_path, tokens);
+}
+
+test "vocab cache roundtrip" {
+    const allocator = std.testing.allocator;
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    const tokens = [_][]const u8{ "a", "b", "ab", "", "hello", " world" };
+    const path = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(path);
+    const cache_path = try std.fs.path.join(allocator, &.{ path, "vocab.m0vc" });
+    defer allocator.free(cache_path);
+
+    try writeFile(allocator, cache_path, &tokens);
+
+    var mapped = try MappedVocab.init(cache_path);
+    defer mapped.deinit();
+
+    try std.testing.expectEqual(@as(u32, tokens.len), mapped.token_count);
+    for (tokens, 0..) |token, rank| {
+        if (token.len == 0) {
+            try std.testing.expectEqual(@as(?[]const u8, null), mapped.getToken(@intCast(rank)));
+            continue;
+        }
+        try std.testing.expectEqualStrings(token, mapped.getToken(@intCast(rank)).?);
+        try std.testing.expectEqual(@as(u32, @intCast(rank)), mapped.getRank(token).?);
+    }
+    try std.testing.expectEqual(@as(?u32, null), mapped.getRank("missing"));
+}
+
+test "compile json vocabulary and map it back" {
+    const allocator = std.testing.allocator;
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    // base64("a")=YQ==, base64("ab")=YWI=, base64("hello")=aGVsbG8=
+    // rank 2 is deliberately absent to exercise the sparse-gap path
+    const vocab_json =
+        \\{"vocab": {"YQ==": 0, "YWI=": 1, "aGVsbG8=": 3}}
+    ;
+
+    try tmp.dir.writeFile(.{ .sub_path = "vocab.json", .data = vocab_json });
+
+    const dir_path = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(dir_path);
+    const json_path = try std.fs.path.join(allocator, &.{ dir_path, "vocab.json" });
+    defer allocator.free(json_path);
+    const cache_path = try std.fs.path.join(allocator, &.{ dir_path, "vocab.m0vc" });
+    defer allocator.free(cache_path);
+
+    try compileFromJsonFile(allocator, json_path, cache_path);
+
+    var mapped = try MappedVocab.init(cache_path);
+    defer mapped.deinit();
+
+    try std.testing.expectEqual(@as(u32, 4), mapped.token_count);
+    try std.testing.expectEqualStrings("a", mapped.getToken(0).?);
+    try std.testing.expectEqualStrings("ab", mapped.getToken(1).?);
+    try std.testing.expectEqual(@as(?[]const u8, null), mapped.getToken(2));
+    try std.testing.expectEqualStrings("hello", mapped.getToken(3).?);
+    try std.testing.expectEqual(@as(?u32, null), mapped.getRank("missing"));
+    try std.testing.expectEqual(@as(u32, 3), mapped.getRank("hello").?);
+}
@@ -13,12 +13,73 @@ pub const ComptimeValue = core.ComptimeValue;
 const isConstantList = core.isConstantList;
 const allSameType = core.allSameType;
 
+/// Execution limits for comptime function calls - a fold is abandoned (and
+/// the call compiled normally) rather than letting the compiler spin on an
+/// unbounded loop or runaway recursion.
+const MAX_EXEC_STEPS = 100_000;
+const MAX_CALL_DEPTH = 8;
+
 /// Compile-time evaluator for constant expressions
 pub const ComptimeEvaluator = struct {
     allocator: std.mem.Allocator,
 
+    // Module-level functions eligible for compile-time call evaluation
+    user_functions: std.StringHashMap(ast.Node.FunctionDef),
+
+    // Active local scope during comptime function execution (null at module level)
+    locals: ?*Frame = null,
+    call_depth: usize = 0,
+    steps: usize = 0,
+
+    const Frame = std.StringHashMap(ComptimeValue);
+
+    /// Statement outcome during comptime function execution
+    const Flow = union(enum) {
+        next,
+        brk,
+        cont,
+        ret: ComptimeValue,
+    };
+
     pub fn init(allocator: std.mem.Allocator) ComptimeEvaluator {
-        return .{ .allocator = allocator };
+        return .{
+            .allocator = allocator,
+            .user_functions = std.StringHashMap(ast.Node.FunctionDef).init(allocator),
+        };
+    }
+
+    pub fn deinit(self: *ComptimeEvaluator) void {
+        self.user_functions.deinit();
+    }
+
+    /// Register a module-level function as a candidate for compile-time call
+    /// evaluation. Only structurally pure functions are accepted: no async, no
+    /// decorators, no *args/**kwargs, and a body built from assignments,
+    /// returns, if/for/while and loop control only. Side effects that slip
+    /// past the structural check (calls to unsupported functions, reads of
+    /// globals) still abort the fold at execution time because tryEval
+    /// returns null for them.
+    pub fn registerFunction(self: *ComptimeEvaluator, func: ast.Node.FunctionDef) !void {
+        if (func.is_async or func.decorators.len > 0) return;
+        if (func.vararg != null or func.kwarg != null) return;
+        if (!statementsArePure(func.body)) return;
+        try self.user_functions.put(func.name, func);
+    }
+
+    fn statementsArePure(body: []ast.Node) bool {
+        for (body) |stmt| {
+            const ok = switch (stmt) {
+                .assign => |a| a.targets.len == 1 and a.targets[0] == .name,
+                .aug_assign => |a| a.target.* == .name,
+                .return_stmt, .expr_stmt, .pass, .break_stmt, .continue_stmt => true,
+                .if_stmt => |i| statementsArePure(i.body) and statementsArePure(i.else_body),
+                .for_stmt => |f| f.target.* == .name and f.orelse_body == null and statementsArePure(f.body),
+                .while_stmt => |w| w.orelse_body == null and statementsArePure(w.body),
+                else => false,
+            };
+            if (!ok) return false;
+        }
+        return true;
     }
 
     pub fn tryEval(self: *ComptimeEvaluator, node: ast.Node) ?ComptimeValue {
@@ -31,12 +92,21 @@ pub const ComptimeEvaluator = struct {
                 .string => |s| ComptimeValue{ .string = s },
                 .none => null, // None cannot be compile-time evaluated
             },
+            // Names resolve only inside a comptime function call - at module
+            // level (or for globals read from inside a function) we cannot
+            // know the value, so the fold aborts
+            .name => |n| if (self.locals) |frame| frame.get(n.id) else null,
             .binop => |op| self.evalBinOp(op),
             .unaryop => |op| self.evalUnaryOp(op),
             .compare => |cmp| self.evalCompare(cmp),
             .boolop => |bop| self.evalBoolOp(bop),
             .call => |call| self.evalCall(call),
             .subscript => |sub| self.evalSubscript(sub),
+            .if_expr => |ie| blk: {
+                const cond = self.tryEval(ie.condition.*) orelse break :blk null;
+                const truthy = self.toBool(cond) orelse break :blk null;
+                break :blk self.tryEval(if (truthy) ie.body.* else ie.orelse_value.*);
+            },
             .list => |l| {
                 if (isConstantList(l.elts) and allSameType(l.elts)) {
                     return null;
@@ -50,7 +120,11 @@ pub const ComptimeEvaluator = struct {
     fn evalBinOp(self: *ComptimeEvaluator, op: ast.Node.BinOp) ?ComptimeValue {
         const left = self.tryEval(op.left.*) orelse return null;
         const right = self.tryEval(op.right.*) orelse return null;
-        return switch (op.op) {
+        return self.applyBinOp(op.op, left, right);
+    }
+
+    fn applyBinOp(self: *ComptimeEvaluator, op: ast.Operator, left: ComptimeValue, right: ComptimeValue) ?ComptimeValue {
+        return switch (op) {
             .Add => arithmetic.evalAdd(self.allocator, left, right),
             .Sub => arithmetic.evalSub(self.allocator, left, right),
             .Mult => arithmetic.evalMul(self.allocator, left, right),
@@ -302,11 +376,179 @@ pub const ComptimeEvaluator = struct {
                 @as(*anyopaque, @ptrCast(self)),
                 tryEvalWrapper,
             );
-            return builtins.evalBuiltin(func_name, call.args);
+            if (builtins.evalBuiltin(func_name, call.args)) |result| {
+                return result;
+            }
+            return self.evalUserCall(func_name, call);
         }
         return null;
     }
 
+    /// Execute a call to a registered pure user function at compile time.
+    /// All arguments must themselves be comptime-evaluable; otherwise the
+    /// fold aborts and the call is compiled normally.
+    fn evalUserCall(self: *ComptimeEvaluator, func_name: []const u8, call: ast.Node.Call) ?ComptimeValue {
+        const func = self.user_functions.get(func_name) orelse return null;
+        if (call.keyword_args.len > 0) return null; // positional binding only
+        if (call.args.len > func.args.len) return null;
+        if (self.call_depth >= MAX_CALL_DEPTH) return null;
+
+        // Evaluate arguments in the caller's scope, bind defaults for the rest
+        var frame = Frame.init(self.allocator);
+        defer frame.deinit();
+        for (func.args, 0..) |param, i| {
+            const value = if (i < call.args.len)
+                self.tryEval(call.args[i]) orelse return null
+            else blk: {
+                const default = param.default orelse return null;
+                break :blk self.tryEval(default.*) orelse return null;
+            };
+            frame.put(param.name, value) catch return null;
+        }
+
+        const saved_locals = self.locals;
+        self.locals = &frame;
+        self.call_depth += 1;
+        defer {
+            self.locals = saved_locals;
+            self.call_depth -= 1;
+        }
+        // Reset the step budget for each outermost call
+        if (self.call_depth == 1) self.steps = 0;
+
+        const flow = self.execBlock(func.body) orelse return null;
+        return switch (flow) {
+            .ret => |value| value,
+            // Falling off the end returns None, which has no ComptimeValue
+            else => null,
+        };
+    }
+
+    fn execBlock(self: *ComptimeEvaluator, body: []ast.Node) ?Flow {
+        for (body) |stmt| {
+            const flow = self.execStmt(stmt) orelse return null;
+            if (flow != .next) return flow;
+        }
+        return .next;
+    }
+
+    fn execStmt(self: *ComptimeEvaluator, stmt: ast.Node) ?Flow {
+        self.steps += 1;
+        if (self.steps > MAX_EXEC_STEPS) return null;
+
+        switch (stmt) {
+            .assign => |a| {
+                if (a.targets.len != 1 or a.targets[0] != .name) return null;
+                const value = self.tryEval(a.value.*) orelse return null;
+                const frame = self.locals orelse return null;
+                frame.put(a.targets[0].name.id, value) catch return null;
+                return .next;
+            },
+            .aug_assign => |a| {
+                if (a.target.* != .name) return null;
+                const frame = self.locals orelse return null;
+                const current = frame.get(a.target.name.id) orelse return null;
+                const rhs = self.tryEval(a.value.*) orelse return null;
+                const result = self.applyBinOp(a.op, current, rhs) orelse return null;
+                frame.put(a.target.name.id, result) catch return null;
+                return .next;
+            },
+            .return_stmt => |r| {
+                const value_node = r.value orelse return null; // bare return -> None
+                const value = self.tryEval(value_node.*) orelse return null;
+                return Flow{ .ret = value };
+            },
+            .if_stmt => |i| {
+                const cond = self.tryEval(i.condition.*) orelse return null;
+                const truthy = self.toBool(cond) orelse return null;
+                return self.execBlock(if (truthy) i.body else i.else_body);
+            },
+            .while_stmt => |w| {
+                while (true) {
+                    self.steps += 1;
+                    if (self.steps > MAX_EXEC_STEPS) return null;
+                    const cond = self.tryEval(w.condition.*) orelse return null;
+                    if (!(self.toBool(cond) orelse return null)) break;
+                    const flow = self.execBlock(w.body) orelse return null;
+                    switch (flow) {
+                        .next, .cont => {},
+                        .brk => break,
+                        .ret => return flow,
+                    }
+                }
+                return .next;
+            },
+            .for_stmt => |f| return self.execFor(f),
+            .expr_stmt => |e| {
+                // Evaluate and discard (docstrings, pure expressions). A
+                // null here means the expression has effects we cannot
+                // model - print(), method calls - so the fold must abort
+                // rather than silently drop them.
+                _ = self.tryEval(e.value.*) orelse return null;
+                return .next;
+            },
+            .pass => return .next,
+            .break_stmt => return .brk,
+            .continue_stmt => return .cont,
+            else => return null,
+        }
+    }
+
+    fn execFor(self: *ComptimeEvaluator, f: ast.Node.For) ?Flow {
+        if (f.target.* != .name) return null;
+        const target_name = f.target.name.id;
+        const frame = self.locals orelse return null;
+
+        // Iterate range(...) directly without materializing a list
+        if (self.evalRangeArgs(f.iter.*)) |r| {
+            var i = r.start;
+            while (if (r.step > 0) i < r.stop else i > r.stop) : (i += r.step) {
+                frame.put(target_name, ComptimeValue{ .int = i }) catch return null;
+                const flow = self.execBlock(f.body) orelse return null;
+                switch (flow) {
+                    .next, .cont => {},
+                    .brk => return .next,
+                    .ret => return flow,
+                }
+            }
+            return .next;
+        }
+
+        const iterable = self.tryEval(f.iter.*) orelse return null;
+        if (iterable != .list) return null;
+        for (iterable.list) |item| {
+            frame.put(target_name, item) catch return null;
+            const flow = self.execBlock(f.body) orelse return null;
+            switch (flow) {
+                .next, .cont => {},
+                .brk => break,
+                .ret => return flow,
+            }
+        }
+        return .next;
+    }
+
+    const Range = struct { start: i64, stop: i64, step: i64 };
+
+    fn evalRangeArgs(self: *ComptimeEvaluator, node: ast.Node) ?Range {
+        if (node != .call) return null;
+        const call = node.call;
+        if (call.func.* != .name) return null;
+        if (!std.mem.eql(u8, call.func.name.id, "range")) return null;
+        if (call.args.len == 0 or call.args.len > 3) return null;
+        var vals: [3]i64 = undefined;
+        for (call.args, 0..) |arg, i| {
+            const v = self.tryEval(arg) orelse return null;
+            if (v != .int) return null;
+            vals[i] = v.int;
+        }
+        return switch (call.args.len) {
+            1 => Range{ .start = 0, .stop = vals[0], .step = 1 },
+            2 => Range{ .start = vals[0], .stop = vals[1], .step = 1 },
+            else => if (vals[2] == 0) null else Range{ .start = vals[0], .stop = vals[1], .step = vals[2] },
+        };
+    }
+
     fn evalMethod(self: *ComptimeEvaluator, obj: ComptimeValue, method: []const u8, args: []ast.Node) ?ComptimeValue {
         if (obj != .string) return null;
         const s = obj.string;
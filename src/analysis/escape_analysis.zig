@@ -0,0 +1,694 @@
+/// Escape analysis: prove that no heap allocation made inside a function
+/// can outlive the function call.
+///
+/// When this holds, codegen routes __global_allocator through a
+/// function-scoped ArenaAllocator for the duration of the call, so every
+/// temporary string, loop-local list and intermediate dict is bulk-freed
+/// at return instead of going through individual alloc/free pairs.
+///
+/// The analysis is deliberately conservative: any construct that could
+/// smuggle arena memory out of the function (returning a non-scalar value,
+/// storing into a parameter or global, calling an unknown function) makes
+/// the whole function ineligible. A false negative only costs the
+/// optimization; a false positive would be a use-after-free.
+const std = @import("std");
+const ast = @import("ast");
+
+/// Maximum local names tracked per function (matches the fixed-size
+/// collection pattern in allocator_analyzer.zig)
+const MAX_LOCALS = 64;
+
+/// Builtins whose calls never retain their arguments beyond the call.
+/// Results may be allocated, but only into the caller's (arena) allocator.
+const SafeBuiltins = std.StaticStringMap(void).initComptime(.{
+    .{ "print", {} },
+    .{ "len", {} },
+    .{ "range", {} },
+    .{ "abs", {} },
+    .{ "min", {} },
+    .{ "max", {} },
+    .{ "sum", {} },
+    .{ "ord", {} },
+    .{ "chr", {} },
+    .{ "int", {} },
+    .{ "float", {} },
+    .{ "bool", {} },
+    .{ "str", {} },
+    .{ "round", {} },
+    .{ "enumerate", {} },
+    .{ "zip", {} },
+    .{ "sorted", {} },
+    .{ "reversed", {} },
+    .{ "isinstance", {} },
+    .{ "repr", {} },
+});
+
+/// Builtins that always produce a scalar (non-heap) result
+const ScalarBuiltins = std.StaticStringMap(void).initComptime(.{
+    .{ "len", {} },
+    .{ "abs", {} },
+    .{ "sum", {} },
+    .{ "ord", {} },
+    .{ "int", {} },
+    .{ "float", {} },
+    .{ "bool", {} },
+    .{ "round", {} },
+    .{ "isinstance", {} },
+});
+
+/// Entry point: true when every allocation in `func` provably stays local,
+/// so the body can run against a function-scoped arena.
+pub fn functionAllocationsStayLocal(func: ast.Node.FunctionDef) bool {
+    // Generators, async tasks and decorated/variadic functions have
+    // non-local control or wrapper frames - skip them outright
+    if (func.is_async) return false;
+    if (func.decorators.len > 0) return false;
+    if (func.vararg != null or func.kwarg != null) return false;
+
+    // First pass: collect names bound inside the body. Stores into these
+    // are function-local; stores into anything else may escape.
+    var locals: [MAX_LOCALS][]const u8 = undefined;
+    var local_count: usize = 0;
+    if (!collectLocalNames(func.body, &locals, &local_count)) return false;
+
+    // Second pass: drop names that may alias caller-owned memory
+    // (`alias = items`, `x = obj.field`, `for row in rows:`). Mutating
+    // through such a binding would publish arena memory into the
+    // caller's object, so they must not count as local receivers.
+    pruneAliasedNames(func.body, &locals, &local_count);
+
+    for (func.body) |stmt| {
+        if (!stmtStaysLocal(func, stmt, locals[0..local_count])) return false;
+    }
+    return true;
+}
+
+/// Collect names assigned in the body (assignment targets and loop
+/// variables). Returns false if the body binds more names than we
+/// track - bail rather than misclassify a store as local.
+fn collectLocalNames(stmts: []ast.Node, names: *[MAX_LOCALS][]const u8, count: *usize) bool {
+    for (stmts) |stmt| {
+        switch (stmt) {
+            .assign => |a| {
+                for (a.targets) |target| {
+                    if (!collectTargetNames(target, names, count)) return false;
+                }
+            },
+            .ann_assign => |a| {
+                if (!collectTargetNames(a.target.*, names, count)) return false;
+            },
+            .aug_assign => |a| {
+                if (!collectTargetNames(a.target.*, names, count)) return false;
+            },
+            .for_stmt => |f| {
+                if (!collectTargetNames(f.target.*, names, count)) return false;
+                if (!collectLocalNames(f.body, names, count)) return false;
+                if (f.orelse_body) |ob| {
+                    if (!collectLocalNames(ob, names, count)) return false;
+                }
+            },
+            .while_stmt => |w| {
+                if (!collectLocalNames(w.body, names, count)) return false;
+                if (w.orelse_body) |ob| {
+                    if (!collectLocalNames(ob, names, count)) return false;
+                }
+            },
+            .if_stmt => |i| {
+                if (!collectLocalNames(i.body, names, count)) return false;
+                if (!collectLocalNames(i.else_body, names, count)) return false;
+            },
+            .try_stmt => |t| {
+                if (!collectLocalNames(t.body, names, count)) return false;
+                for (t.handlers) |h| {
+                    if (!collectLocalNames(h.body, names, count)) return false;
+                }
+                if (!collectLocalNames(t.else_body, names, count)) return false;
+                if (!collectLocalNames(t.finalbody, names, count)) return false;
+            },
+            else => {},
+        }
+    }
+    return true;
+}
+
+fn collectTargetNames(target: ast.Node, names: *[MAX_LOCALS][]const u8, count: *usize) bool {
+    switch (target) {
+        .name => |n| {
+            if (isLocalName(n.id, names[0..count.*])) return true; // already tracked
+            if (count.* >= MAX_LOCALS) return false;
+            names[count.*] = n.id;
+            count.* += 1;
+            return true;
+        },
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                if (!collectTargetNames(elt, names, count)) return false;
+            }
+            return true;
+        },
+        // Subscript/attribute targets bind no new name; the store itself
+        // is vetted in stmtStaysLocal
+        else => return true,
+    }
+}
+
+/// Remove names whose bindings are not provably fresh objects. A name
+/// survives only if every binding's RHS allocates a new value inside
+/// this function (literal, scalar-builtin call, fstring, arithmetic);
+/// bindings from another name, a subscript/attribute load, any other
+/// call, or a for-target over anything but range() may hand back
+/// caller memory.
+fn pruneAliasedNames(stmts: []ast.Node, names: *[MAX_LOCALS][]const u8, count: *usize) void {
+    for (stmts) |stmt| {
+        switch (stmt) {
+            .assign => |a| {
+                if (!exprProducesFreshValue(a.value.*)) {
+                    for (a.targets) |target| {
+                        removeTargetNames(target, names, count);
+                    }
+                }
+            },
+            .ann_assign => |a| {
+                if (a.value) |v| {
+                    if (!exprProducesFreshValue(v.*)) {
+                        removeTargetNames(a.target.*, names, count);
+                    }
+                }
+            },
+            .aug_assign => |a| {
+                // `x += param` splices caller elements into x
+                if (!exprProducesFreshValue(a.value.*)) {
+                    removeTargetNames(a.target.*, names, count);
+                }
+            },
+            .for_stmt => |f| {
+                // Only range() provably yields fresh (scalar) values;
+                // any other iterable lends out its elements
+                if (!iterIsRangeCall(f.iter.*)) {
+                    removeTargetNames(f.target.*, names, count);
+                }
+                pruneAliasedNames(f.body, names, count);
+                if (f.orelse_body) |ob| pruneAliasedNames(ob, names, count);
+            },
+            .while_stmt => |w| {
+                pruneAliasedNames(w.body, names, count);
+                if (w.orelse_body) |ob| pruneAliasedNames(ob, names, count);
+            },
+            .if_stmt => |i| {
+                pruneAliasedNames(i.body, names, count);
+                pruneAliasedNames(i.else_body, names, count);
+            },
+            .try_stmt => |t| {
+                pruneAliasedNames(t.body, names, count);
+                for (t.handlers) |h| {
+                    pruneAliasedNames(h.body, names, count);
+                }
+                pruneAliasedNames(t.else_body, names, count);
+                pruneAliasedNames(t.finalbody, names, count);
+            },
+            else => {},
+        }
+    }
+}
+
+fn removeTargetNames(target: ast.Node, names: *[MAX_LOCALS][]const u8, count: *usize) void {
+    switch (target) {
+        .name => |n| {
+            var i: usize = 0;
+            while (i < count.*) : (i += 1) {
+                if (std.mem.eql(u8, names[i], n.id)) {
+                    names[i] = names[count.* - 1];
+                    count.* -= 1;
+                    return;
+                }
+            }
+        },
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                removeTargetNames(elt, names, count);
+            }
+        },
+        else => {},
+    }
+}
+
+/// True when the expression's value is a freshly created object (or a
+/// scalar) that cannot be the same object as - or contain - anything
+/// the caller owns. Container literals require fresh elements too:
+/// `[param]` is a new list, but mutating through its element would
+/// still reach caller memory.
+fn exprProducesFreshValue(expr: ast.Node) bool {
+    switch (expr) {
+        .constant, .ellipsis_literal => return true,
+        .compare, .boolop => return true, // bool result
+        .fstring => return true, // newly built string
+        .unaryop => |u| return exprProducesFreshValue(u.operand.*),
+        // Concatenation copies, but the copy shares elements - require
+        // fresh operands so the result is fresh all the way down
+        .binop => |b| return exprProducesFreshValue(b.left.*) and
+            exprProducesFreshValue(b.right.*),
+        .if_expr => |i| return exprProducesFreshValue(i.body.*) and
+            exprProducesFreshValue(i.orelse_value.*),
+        .list => |l| {
+            for (l.elts) |elt| {
+                if (!exprProducesFreshValue(elt)) return false;
+            }
+            return true;
+        },
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                if (!exprProducesFreshValue(elt)) return false;
+            }
+            return true;
+        },
+        .set => |s| {
+            for (s.elts) |elt| {
+                if (!exprProducesFreshValue(elt)) return false;
+            }
+            return true;
+        },
+        .dict => |d| {
+            for (d.keys) |key| {
+                if (!exprProducesFreshValue(key)) return false;
+            }
+            for (d.values) |value| {
+                if (!exprProducesFreshValue(value)) return false;
+            }
+            return true;
+        },
+        // Only scalar-returning builtins are exempt. sorted()/reversed()
+        // build new containers but their elements alias the argument's,
+        // and min()/max() can hand back an argument outright - so any
+        // other call may put caller memory behind the bound name
+        .call => |c| {
+            if (c.func.* == .name) return ScalarBuiltins.has(c.func.name.id);
+            return false;
+        },
+        // Names, subscript/attribute loads, anything else: may alias
+        else => return false,
+    }
+}
+
+fn isLocalName(name: []const u8, locals: []const []const u8) bool {
+    for (locals) |local| {
+        if (std.mem.eql(u8, name, local)) return true;
+    }
+    return false;
+}
+
+fn isParamName(func: ast.Node.FunctionDef, name: []const u8) bool {
+    for (func.args) |arg| {
+        if (std.mem.eql(u8, name, arg.name)) return true;
+    }
+    return false;
+}
+
+/// Check one statement for escaping stores or calls
+fn stmtStaysLocal(func: ast.Node.FunctionDef, stmt: ast.Node, locals: []const []const u8) bool {
+    switch (stmt) {
+        .assign => |a| {
+            for (a.targets) |target| {
+                if (!storeTargetIsLocal(target, locals)) return false;
+            }
+            return exprStaysLocal(func, a.value.*, locals);
+        },
+        .ann_assign => |a| {
+            if (!storeTargetIsLocal(a.target.*, locals)) return false;
+            if (a.value) |v| return exprStaysLocal(func, v.*, locals);
+            return true;
+        },
+        .aug_assign => |a| {
+            if (!storeTargetIsLocal(a.target.*, locals)) return false;
+            return exprStaysLocal(func, a.value.*, locals);
+        },
+        .expr_stmt => |e| return exprStaysLocal(func, e.value.*, locals),
+        .return_stmt => |r| {
+            if (r.value) |v| {
+                // The returned value must not carry arena memory out
+                if (!exprIsScalarValue(func, v.*)) return false;
+                return exprStaysLocal(func, v.*, locals);
+            }
+            return true;
+        },
+        .if_stmt => |i| {
+            if (!exprStaysLocal(func, i.condition.*, locals)) return false;
+            return blockStaysLocal(func, i.body, locals) and
+                blockStaysLocal(func, i.else_body, locals);
+        },
+        .while_stmt => |w| {
+            if (!exprStaysLocal(func, w.condition.*, locals)) return false;
+            if (!blockStaysLocal(func, w.body, locals)) return false;
+            if (w.orelse_body) |ob| return blockStaysLocal(func, ob, locals);
+            return true;
+        },
+        .for_stmt => |f| {
+            if (!exprStaysLocal(func, f.iter.*, locals)) return false;
+            if (!blockStaysLocal(func, f.body, locals)) return false;
+            if (f.orelse_body) |ob| return blockStaysLocal(func, ob, locals);
+            return true;
+        },
+        .try_stmt => |t| {
+            if (!blockStaysLocal(func, t.body, locals)) return false;
+            for (t.handlers) |h| {
+                if (!blockStaysLocal(func, h.body, locals)) return false;
+            }
+            return blockStaysLocal(func, t.else_body, locals) and
+                blockStaysLocal(func, t.finalbody, locals);
+        },
+        .raise_stmt => |r| {
+            if (r.exc) |exc| return exprStaysLocal(func, exc.*, locals);
+            return true;
+        },
+        .assert_stmt => |a| {
+            if (!exprStaysLocal(func, a.condition.*, locals)) return false;
+            if (a.msg) |m| return exprStaysLocal(func, m.*, locals);
+            return true;
+        },
+        .del_stmt => |d| {
+            for (d.targets) |target| {
+                if (target != .name) return false;
+            }
+            return true;
+        },
+        .pass, .break_stmt, .continue_stmt => return true,
+        // Escaping or opaque constructs: globals, closures, generators,
+        // context managers (file handles outlive statements), imports
+        else => return false,
+    }
+}
+
+fn blockStaysLocal(func: ast.Node.FunctionDef, stmts: []ast.Node, locals: []const []const u8) bool {
+    for (stmts) |stmt| {
+        if (!stmtStaysLocal(func, stmt, locals)) return false;
+    }
+    return true;
+}
+
+/// A store target is safe when it writes a function-local binding.
+/// Subscript/attribute stores are only safe when rooted at a local name -
+/// writing through a parameter or global would publish arena memory.
+fn storeTargetIsLocal(target: ast.Node, locals: []const []const u8) bool {
+    switch (target) {
+        .name => return true, // binds/rebinds a local
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                if (!storeTargetIsLocal(elt, locals)) return false;
+            }
+            return true;
+        },
+        .subscript => |s| return storeBaseIsLocal(s.value.*, locals),
+        .attribute => |a| return storeBaseIsLocal(a.value.*, locals),
+        else => return false,
+    }
+}
+
+fn storeBaseIsLocal(base: ast.Node, locals: []const []const u8) bool {
+    return switch (base) {
+        .name => |n| isLocalName(n.id, locals),
+        .subscript => |s| storeBaseIsLocal(s.value.*, locals),
+        .attribute => |a| storeBaseIsLocal(a.value.*, locals),
+        else => false,
+    };
+}
+
+/// Walk an expression looking for constructs that can leak arena memory:
+/// calls to unknown functions, method calls on caller-owned values,
+/// closures, await/yield.
+fn exprStaysLocal(func: ast.Node.FunctionDef, expr: ast.Node, locals: []const []const u8) bool {
+    switch (expr) {
+        .constant, .name, .ellipsis_literal => return true,
+        .binop => |b| return exprStaysLocal(func, b.left.*, locals) and
+            exprStaysLocal(func, b.right.*, locals),
+        .unaryop => |u| return exprStaysLocal(func, u.operand.*, locals),
+        .compare => |c| {
+            if (!exprStaysLocal(func, c.left.*, locals)) return false;
+            for (c.comparators) |comp| {
+                if (!exprStaysLocal(func, comp, locals)) return false;
+            }
+            return true;
+        },
+        .boolop => |b| {
+            for (b.values) |v| {
+                if (!exprStaysLocal(func, v, locals)) return false;
+            }
+            return true;
+        },
+        .if_expr => |i| return exprStaysLocal(func, i.condition.*, locals) and
+            exprStaysLocal(func, i.body.*, locals) and
+            exprStaysLocal(func, i.orelse_value.*, locals),
+        .list => |l| {
+            for (l.elts) |elt| {
+                if (!exprStaysLocal(func, elt, locals)) return false;
+            }
+            return true;
+        },
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                if (!exprStaysLocal(func, elt, locals)) return false;
+            }
+            return true;
+        },
+        .set => |s| {
+            for (s.elts) |elt| {
+                if (!exprStaysLocal(func, elt, locals)) return false;
+            }
+            return true;
+        },
+        .dict => |d| {
+            for (d.keys) |key| {
+                if (!exprStaysLocal(func, key, locals)) return false;
+            }
+            for (d.values) |value| {
+                if (!exprStaysLocal(func, value, locals)) return false;
+            }
+            return true;
+        },
+        .subscript => |s| {
+            if (!exprStaysLocal(func, s.value.*, locals)) return false;
+            switch (s.slice) {
+                .index => |idx| return exprStaysLocal(func, idx.*, locals),
+                .slice => |range| {
+                    if (range.lower) |lo| {
+                        if (!exprStaysLocal(func, lo.*, locals)) return false;
+                    }
+                    if (range.upper) |hi| {
+                        if (!exprStaysLocal(func, hi.*, locals)) return false;
+                    }
+                    if (range.step) |st| {
+                        if (!exprStaysLocal(func, st.*, locals)) return false;
+                    }
+                    return true;
+                },
+            }
+        },
+        .attribute => |a| return exprStaysLocal(func, a.value.*, locals),
+        .fstring => |f| {
+            for (f.parts) |part| {
+                const inner = switch (part) {
+                    .literal => continue,
+                    .expr => |e| e,
+                    .format_expr => |fe| fe.expr,
+                    .conv_expr => |ce| ce.expr,
+                };
+                if (!exprStaysLocal(func, inner.*, locals)) return false;
+            }
+            return true;
+        },
+        .starred => |s| return exprStaysLocal(func, s.value.*, locals),
+        .call => |c| return callStaysLocal(func, c, locals),
+        // Comprehensions, lambdas, yield/await and anything unrecognized:
+        // generated code may capture state or allocate behind our back
+        else => return false,
+    }
+}
+
+/// Calls are the main escape hatch. Allow:
+/// - whitelisted builtins (never retain their arguments)
+/// - direct recursion (the callee re-runs this same analysis at its own
+///   call depth, with its own arena)
+/// - method calls rooted at a local name or a temporary expression;
+///   methods on parameters could insert arena memory into caller state
+fn callStaysLocal(func: ast.Node.FunctionDef, call: ast.Node.Call, locals: []const []const u8) bool {
+    // Keyword arguments imply an unknown user function - bail
+    if (call.keyword_args.len > 0) return false;
+
+    switch (call.func.*) {
+        .name => |n| {
+            const is_safe = SafeBuiltins.has(n.id) or std.mem.eql(u8, n.id, func.name);
+            if (!is_safe) return false;
+        },
+        .attribute => |a| {
+            if (!methodBaseIsLocal(func, a.value.*, locals)) return false;
+            if (!exprStaysLocal(func, a.value.*, locals)) return false;
+        },
+        else => return false,
+    }
+
+    for (call.args) |arg| {
+        if (!exprStaysLocal(func, arg, locals)) return false;
+    }
+    return true;
+}
+
+/// A method receiver is safe when it is a local binding (post-pruning,
+/// so provably fresh - see pruneAliasedNames) or a temporary produced
+/// inside this function (constant, call result, fstring, slice). Bare
+/// parameter or global names and aliases of them are caller-owned -
+/// mutations on them could retain arena memory past the return.
+fn methodBaseIsLocal(func: ast.Node.FunctionDef, base: ast.Node, locals: []const []const u8) bool {
+    return switch (base) {
+        .name => |n| isLocalName(n.id, locals),
+        .constant, .fstring, .list, .tuple, .dict, .set => true,
+        .call => |c| callStaysLocal(func, c, locals),
+        .subscript => |s| methodBaseIsLocal(func, s.value.*, locals),
+        .attribute => |a| methodBaseIsLocal(func, a.value.*, locals),
+        else => false,
+    };
+}
+
+/// True when the expression produces a scalar (or otherwise non-arena)
+/// value: numbers, bools, comparisons, static string literals, or
+/// never-reassigned names (parameters and module globals hold caller
+/// memory, not arena memory).
+fn exprIsScalarValue(func: ast.Node.FunctionDef, expr: ast.Node) bool {
+    switch (expr) {
+        .constant => return true, // string literals are static data
+        .compare, .boolop => return true, // always a bool result
+        .unaryop => |u| return exprIsScalarValue(func, u.operand.*),
+        .if_expr => |i| return exprIsScalarValue(func, i.body.*) and
+            exprIsScalarValue(func, i.orelse_value.*),
+        // Binops may be string/list concatenation - require numeric operands
+        .binop => |b| return exprIsNumeric(func, b.left.*) and
+            exprIsNumeric(func, b.right.*),
+        .name => |n| return nameHoldsScalar(func, n.id),
+        .call => |c| {
+            if (c.func.* == .name) return ScalarBuiltins.has(c.func.name.id);
+            return false;
+        },
+        else => return false,
+    }
+}
+
+/// Numeric-only subset of exprIsScalarValue (safe under +, *, etc.)
+fn exprIsNumeric(func: ast.Node.FunctionDef, expr: ast.Node) bool {
+    switch (expr) {
+        .constant => |c| return switch (c.value) {
+            .int, .float, .bool => true,
+            else => false,
+        },
+        .unaryop => |u| return exprIsNumeric(func, u.operand.*),
+        .binop => |b| return exprIsNumeric(func, b.left.*) and
+            exprIsNumeric(func, b.right.*),
+        .name => |n| return nameHoldsNumeric(func, n.id),
+        .call => |c| {
+            if (c.func.* == .name) return ScalarBuiltins.has(c.func.name.id);
+            return false;
+        },
+        else => return false,
+    }
+}
+
+/// A name holds a scalar if it is never bound in the body (parameter or
+/// module global - caller memory either way) or every binding is scalar.
+fn nameHoldsScalar(func: ast.Node.FunctionDef, name: []const u8) bool {
+    return nameBindingsSatisfy(func, func.body, name, false);
+}
+
+fn nameHoldsNumeric(func: ast.Node.FunctionDef, name: []const u8) bool {
+    // Parameters and globals have unknown types - only trust bindings we
+    // can see, and require at least the ones we see to be numeric
+    if (isParamName(func, name)) return false;
+    return nameBindingsSatisfy(func, func.body, name, true);
+}
+
+/// Walk all bindings of `name` in the body; every one must be scalar
+/// (numeric_only: numeric). Name-to-name copies are rejected to keep the
+/// check cycle-free.
+fn nameBindingsSatisfy(func: ast.Node.FunctionDef, stmts: []ast.Node, name: []const u8, numeric_only: bool) bool {
+    for (stmts) |stmt| {
+        switch (stmt) {
+            .assign => |a| {
+                if (!targetBindsName(a.targets, name)) continue;
+                if (a.value.* == .name) return false; // avoid alias cycles
+                const ok = if (numeric_only)
+                    exprIsNumeric(func, a.value.*)
+                else
+                    exprIsScalarValue(func, a.value.*);
+                if (!ok) return false;
+            },
+            .ann_assign => |a| {
+                if (a.target.* != .name or !std.mem.eql(u8, a.target.name.id, name)) continue;
+                if (a.value) |v| {
+                    if (v.* == .name) return false;
+                    const ok = if (numeric_only)
+                        exprIsNumeric(func, v.*)
+                    else
+                        exprIsScalarValue(func, v.*);
+                    if (!ok) return false;
+                }
+            },
+            .aug_assign => |a| {
+                if (a.target.* != .name or !std.mem.eql(u8, a.target.name.id, name)) continue;
+                // Augmented assigns on strings/lists concatenate - require
+                // the increment to be numeric regardless of mode
+                if (!exprIsNumeric(func, a.value.*)) return false;
+            },
+            .for_stmt => |f| {
+                if (forTargetBindsName(f.target.*, name)) {
+                    // Only range() iteration provably yields numbers
+                    if (!iterIsRangeCall(f.iter.*)) return false;
+                }
+                if (!nameBindingsSatisfy(func, f.body, name, numeric_only)) return false;
+                if (f.orelse_body) |ob| {
+                    if (!nameBindingsSatisfy(func, ob, name, numeric_only)) return false;
+                }
+            },
+            .while_stmt => |w| {
+                if (!nameBindingsSatisfy(func, w.body, name, numeric_only)) return false;
+                if (w.orelse_body) |ob| {
+                    if (!nameBindingsSatisfy(func, ob, name, numeric_only)) return false;
+                }
+            },
+            .if_stmt => |i| {
+                if (!nameBindingsSatisfy(func, i.body, name, numeric_only)) return false;
+                if (!nameBindingsSatisfy(func, i.else_body, name, numeric_only)) return false;
+            },
+            .try_stmt => |t| {
+                if (!nameBindingsSatisfy(func, t.body, name, numeric_only)) return false;
+                for (t.handlers) |h| {
+                    if (!nameBindingsSatisfy(func, h.body, name, numeric_only)) return false;
+                }
+                if (!nameBindingsSatisfy(func, t.else_body, name, numeric_only)) return false;
+                if (!nameBindingsSatisfy(func, t.finalbody, name, numeric_only)) return false;
+            },
+            else => {},
+        }
+    }
+    return true;
+}
+
+fn targetBindsName(targets: []ast.Node, name: []const u8) bool {
+    for (targets) |target| {
+        if (forTargetBindsName(target, name)) return true;
+    }
+    return false;
+}
+
+fn forTargetBindsName(target: ast.Node, name: []const u8) bool {
+    return switch (target) {
+        .name => |n| std.mem.eql(u8, n.id, name),
+        .tuple => |t| {
+            for (t.elts) |elt| {
+                if (forTargetBindsName(elt, name)) return true;
+            }
+            return false;
+        },
+        else => false,
+    };
+}
+
+fn iterIsRangeCall(iter: ast.Node) bool {
+    if (iter != .call) return false;
+    const call = iter.call;
+    return call.func.* == .name and std.mem.eql(u8, call.func.name.id, "range");
+}
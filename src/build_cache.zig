@@ -0,0 +1,147 @@
+/// Persistent content-hash build cache for compiled artifacts
+///
+/// Keys are SHA256 over the generated Zig source, the c_libraries list, the
+/// artifact kind (exe/lib/wasm) and a toolchain stamp. Cached binaries live
+/// in .build/cache/<hex>, so byte-identical generated programs skip the
+/// `zig build-exe` subprocess entirely on rebuilds.
+const std = @import("std");
+const builtin = @import("builtin");
+
+/// Directory holding cached artifacts (inside the shared .build tree)
+const CACHE_DIR = ".build/cache";
+
+/// Best-effort cap on cached artifacts: store() evicts the oldest entries
+/// beyond it so the cache cannot grow without bound.
+const MAX_CACHE_ENTRIES = 64;
+
+/// Cached binaries also embed the runtime packages and the Zig compiler's
+/// codegen, neither of which appears in the generated source - without a
+/// stamp, editing the runtime or upgrading Zig would silently serve stale
+/// binaries. The Zig version covers toolchain upgrades; bump RUNTIME_STAMP
+/// whenever packages/runtime or artifact-affecting codegen changes.
+const RUNTIME_STAMP = "metal0-runtime-1";
+
+/// What kind of artifact a key refers to - part of the hash so an executable
+/// and a shared library built from the same source never collide
+pub const ArtifactKind = enum {
+    exe,
+    shared_lib,
+    wasm,
+};
+
+/// Compute the cache key for a compilation: hex-encoded SHA256 over the
+/// toolchain stamp, the generated source, each C library name, and the
+/// artifact kind
+pub fn computeKey(zig_code: []const u8, c_libraries: []const []const u8, kind: ArtifactKind) [64]u8 {
+    var hasher = std.crypto.hash.sha2.Sha256.init(.{});
+    hasher.update(builtin.zig_version_string);
+    hasher.update("\x00");
+    hasher.update(RUNTIME_STAMP);
+    hasher.update("\x00");
+    hasher.update(zig_code);
+    for (c_libraries) |lib| {
+        // Separator prevents ["ab","c"] and ["a","bc"] from hashing identically
+        hasher.update("\x00");
+        hasher.update(lib);
+    }
+    hasher.update("\x00");
+    hasher.update(@tagName(kind));
+
+    var hash: [32]u8 = undefined;
+    hasher.final(&hash);
+
+    var hex: [64]u8 = undefined;
+    const hex_chars = "0123456789abcdef";
+    for (hash, 0..) |byte, i| {
+        hex[i * 2] = hex_chars[byte >> 4];
+        hex[i * 2 + 1] = hex_chars[byte & 0x0F];
+    }
+    return hex;
+}
+
+fn cachePath(allocator: std.mem.Allocator, key: *const [64]u8) ![]const u8 {
+    return try std.fmt.allocPrint(allocator, "{s}/{s}", .{ CACHE_DIR, key });
+}
+
+/// Try to satisfy a compilation from the cache. On a hit the cached artifact
+/// is copied to output_path and true is returned; on a miss (or any cache I/O
+/// error - the cache must never fail a build) returns false.
+pub fn fetch(allocator: std.mem.Allocator, key: *const [64]u8, output_path: []const u8) bool {
+    const src_path = cachePath(allocator, key) catch return false;
+    defer allocator.free(src_path);
+
+    std.fs.cwd().copyFile(src_path, std.fs.cwd(), output_path, .{}) catch return false;
+
+    // Restore the executable bit - copyFile creates with default permissions
+    const file = std.fs.cwd().openFile(output_path, .{}) catch return true;
+    defer file.close();
+    file.chmod(0o755) catch {};
+
+    return true;
+}
+
+/// Record a freshly built artifact under its key. Best-effort: a full disk or
+/// missing cache dir only costs us the next cache hit, never the build.
+pub fn store(allocator: std.mem.Allocator, key: *const [64]u8, output_path: []const u8) void {
+    std.fs.cwd().makePath(CACHE_DIR) catch return;
+
+    const dst_path = cachePath(allocator, key) catch return;
+    defer allocator.free(dst_path);
+
+    std.fs.cwd().copyFile(output_path, std.fs.cwd(), dst_path, .{}) catch return;
+
+    evictOldest(allocator);
+}
+
+/// Drop the oldest artifacts once the cache exceeds MAX_CACHE_ENTRIES.
+/// Best-effort like the rest of the cache: any error just leaves the
+/// extra entries for a later store() to collect.
+fn evictOldest(allocator: std.mem.Allocator) void {
+    var dir = std.fs.cwd().openDir(CACHE_DIR, .{ .iterate = true }) catch return;
+    defer dir.close();
+
+    const Entry = struct { name: [64]u8, mtime: i128 };
+    var entries = std.ArrayList(Entry){};
+    defer entries.deinit(allocator);
+
+    var it = dir.iterate();
+    while (it.next() catch return) |ent| {
+        if (ent.kind != .file or ent.name.len != 64) continue;
+        const stat = dir.statFile(ent.name) catch continue;
+        var entry = Entry{ .name = undefined, .mtime = stat.mtime };
+        @memcpy(&entry.name, ent.name);
+        entries.append(allocator, entry) catch return;
+    }
+    if (entries.items.len <= MAX_CACHE_ENTRIES) return;
+
+    std.mem.sort(Entry, entries.items, {}, struct {
+        fn olderFirst(_: void, a: Entry, b: Entry) bool {
+            return a.mtime < b.mtime;
+        }
+    }.olderFirst);
+
+    for (entries.items[0 .. entries.items.len - MAX_CACHE_ENTRIES]) |entry| {
+        dir.deleteFile(&entry.name) catch {};
+    }
+}
+
+test "computeKey differs by source, libraries and kind" {
+    const base = computeKey("const x = 1;", &.{}, .exe);
+    const other_src = computeKey("const x = 2;", &.{}, .exe);
+    const with_lib = computeKey("const x = 1;", &.{"curl"}, .exe);
+    const as_lib = computeKey("const x = 1;", &.{}, .shared_lib);
+
+    try std.testing.expect(!std.mem.eql(u8, &base, &other_src));
+    try std.testing.expect(!std.mem.eql(u8, &base, &with_lib));
+    try std.testing.expect(!std.mem.eql(u8, &base, &as_lib));
+
+    // Same inputs must always produce the same key
+    const again = computeKey("const x = 1;", &.{}, .exe);
+    try std.testing.expectEqualSlices(u8, &base, &again);
+}
+
+test "computeKey library list is separator-safe" {
+    const split_a = computeKey("src", &.{ "ab", "c" }, .exe);
+    const split_b = computeKey("src", &.{ "a", "bc" }, .exe);
+    try std.testing.expect(!std.mem.eql(u8, &split_a, &split_b));
+}
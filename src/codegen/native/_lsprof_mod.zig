@@ -11,21 +11,22 @@ pub fn genProfiler(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
 }
 
 /// Generate Profiler.enable(subcalls=True, builtins=True)
+/// Arms the runtime sampling profiler (SIGPROF shadow-stack sampling)
 pub fn genEnable(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.start()");
 }
 
 /// Generate Profiler.disable()
 pub fn genDisable(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.stop()");
 }
 
 /// Generate Profiler.clear()
 pub fn genClear(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.clear()");
 }
 
 /// Generate Profiler.getstats()
@@ -7,25 +7,25 @@ const NativeCodegen = @import("main.zig").NativeCodegen;
 /// Generate _tracemalloc.start(nframe=1)
 pub fn genStart(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.tracemallocStart(&__global_allocator)");
 }
 
 /// Generate _tracemalloc.stop()
 pub fn genStop(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.tracemallocStop(&__global_allocator)");
 }
 
 /// Generate _tracemalloc.is_tracing()
 pub fn genIsTracing(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("false");
+    try self.emit("runtime.profiler.tracemallocIsTracing()");
 }
 
 /// Generate _tracemalloc.clear_traces()
 pub fn genClearTraces(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.clearTraces()");
 }
 
 /// Generate _tracemalloc.get_traceback_limit()
@@ -37,19 +37,19 @@ pub fn genGetTracebackLimit(self: *NativeCodegen, args: []ast.Node) CodegenError
 /// Generate _tracemalloc.get_traced_memory()
 pub fn genGetTracedMemory(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit(".{ @as(i64, 0), @as(i64, 0) }");
+    try self.emit("runtime.profiler.getTracedMemory()");
 }
 
 /// Generate _tracemalloc.reset_peak()
 pub fn genResetPeak(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.resetPeak()");
 }
 
 /// Generate _tracemalloc.get_tracemalloc_memory()
 pub fn genGetTracemallocMemory(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("@as(i64, 0)");
+    try self.emit("runtime.profiler.getTracemallocMemory()");
 }
 
 /// Generate _tracemalloc.get_object_traceback(obj)
@@ -264,6 +264,81 @@ pub const StringBuilder = struct {
     }
 };
 
+/// Rope buffer for assembling large generated modules without realloc churn.
+///
+/// The emit() hot path keeps its contiguous ArrayList because expression
+/// generators slice and truncate `output.items` in place. The rope is for
+/// final assembly: stitching prelude, lambda definitions and the already
+/// generated body together from borrowed chunks with O(1) appends, then
+/// materializing the result exactly once.
+///
+/// Chunks are borrowed - the caller keeps the backing buffers alive until
+/// the rope is consumed.
+pub const Rope = struct {
+    chunks: std.ArrayList([]const u8),
+    total_len: usize,
+
+    pub fn init() Rope {
+        return Rope{
+            .chunks = std.ArrayList([]const u8){},
+            .total_len = 0,
+        };
+    }
+
+    pub fn deinit(self: *Rope, allocator: std.mem.Allocator) void {
+        self.chunks.deinit(allocator);
+    }
+
+    /// Append a chunk (borrowed, no copy) - O(1)
+    pub fn append(self: *Rope, allocator: std.mem.Allocator, chunk: []const u8) !void {
+        if (chunk.len == 0) return;
+        try self.chunks.append(allocator, chunk);
+        self.total_len += chunk.len;
+    }
+
+    /// Insert a chunk before chunk index `at` (splice) - O(chunk count), no byte copies
+    pub fn insert(self: *Rope, allocator: std.mem.Allocator, at: usize, chunk: []const u8) !void {
+        if (chunk.len == 0) return;
+        try self.chunks.insert(allocator, at, chunk);
+        self.total_len += chunk.len;
+    }
+
+    /// Total byte length across all chunks
+    pub fn len(self: *const Rope) usize {
+        return self.total_len;
+    }
+
+    /// Materialize into one contiguous buffer (single allocation, one memcpy per chunk)
+    pub fn toOwnedSlice(self: *Rope, allocator: std.mem.Allocator) ![]u8 {
+        const result = try allocator.alloc(u8, self.total_len);
+        var pos: usize = 0;
+        for (self.chunks.items) |chunk| {
+            @memcpy(result[pos..][0..chunk.len], chunk);
+            pos += chunk.len;
+        }
+        self.chunks.clearRetainingCapacity();
+        self.total_len = 0;
+        return result;
+    }
+};
+
+test "rope assembles chunks in order" {
+    const allocator = std.testing.allocator;
+    var rope = Rope.init();
+    defer rope.deinit(allocator);
+
+    try rope.append(allocator, "const x = ");
+    try rope.append(allocator, "42;\n");
+    try rope.append(allocator, ""); // empty chunks are dropped
+    try rope.insert(allocator, 0, "// header\n");
+    try std.testing.expectEqual(@as(usize, 24), rope.len());
+
+    const joined = try rope.toOwnedSlice(allocator);
+    defer allocator.free(joined);
+    try std.testing.expectEqualStrings("// header\nconst x = 42;\n", joined);
+    try std.testing.expectEqual(@as(usize, 0), rope.len());
+}
+
 /// Template filling utilities (optional enhancement)
 pub const Templates = struct {
     /// Fill template with values
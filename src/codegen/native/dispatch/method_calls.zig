@@ -83,22 +83,26 @@ const FileMethods = std.StaticStringMap(MethodHandler).initComptime(.{
 });
 
 // StringIO/BytesIO stream methods - O(1) lookup
-const StreamMethods = std.StaticStringMap(void).initComptime(.{
-    .{ "write", {} },
-    .{ "read", {} },
-    .{ "getvalue", {} },
-    .{ "seek", {} },
-    .{ "tell", {} },
-    .{ "truncate", {} },
-    .{ "close", {} },
+const StreamMethodType = enum { write, read, getvalue, seek, tell, truncate, close };
+
+const StreamMethods = std.StaticStringMap(StreamMethodType).initComptime(.{
+    .{ "write", .write },
+    .{ "read", .read },
+    .{ "getvalue", .getvalue },
+    .{ "seek", .seek },
+    .{ "tell", .tell },
+    .{ "truncate", .truncate },
+    .{ "close", .close },
 });
 
 // HashObject methods (hashlib.md5(), sha256(), etc.) - O(1) lookup
-const HashMethods = std.StaticStringMap(void).initComptime(.{
-    .{ "update", {} },
-    .{ "digest", {} },
-    .{ "hexdigest", {} },
-    .{ "copy", {} },
+const HashMethodType = enum { update, digest, hexdigest, copy };
+
+const HashMethods = std.StaticStringMap(HashMethodType).initComptime(.{
+    .{ "update", .update },
+    .{ "digest", .digest },
+    .{ "hexdigest", .hexdigest },
+    .{ "copy", .copy },
 });
 
 // Pandas column methods - O(1) lookup via StaticStringMap
@@ -566,45 +570,41 @@ fn handleStreamMethod(self: *NativeCodegen, method_name: []const u8, obj: ast.No
     defer self.allocator.free(receiver);
     self.output = saved_output;
 
-    // Use simple string comparison for method dispatch
-    const fnv = @import("fnv_hash");
-    const WRITE = comptime fnv.hash("write");
-    const READ = comptime fnv.hash("read");
-    const GETVALUE = comptime fnv.hash("getvalue");
-    const SEEK = comptime fnv.hash("seek");
-    const TELL = comptime fnv.hash("tell");
-    const TRUNCATE = comptime fnv.hash("truncate");
-    const CLOSE = comptime fnv.hash("close");
-
-    const method_hash = fnv.hash(method_name);
-    if (method_hash == WRITE) {
-        // stream.write(data) - returns bytes written (caller handles discard if needed)
-        try self.emit(receiver);
-        try self.emit(".write(");
-        if (args.len > 0) try parent.genExpr(self, args[0]);
-        try self.emit(")");
-    } else if (method_hash == READ) {
-        try self.emit(receiver);
-        try self.emit(".read()");
-    } else if (method_hash == GETVALUE) {
-        try self.emit(receiver);
-        try self.emit(".getvalue()");
-    } else if (method_hash == SEEK) {
-        try self.emit(receiver);
-        try self.emit(".seek(");
-        if (args.len > 0) try parent.genExpr(self, args[0]) else try self.emit("0");
-        try self.emit(")");
-    } else if (method_hash == TELL) {
-        try self.emit(receiver);
-        try self.emit(".tell()");
-    } else if (method_hash == TRUNCATE) {
-        try self.emit(receiver);
-        try self.emit(".truncate()");
-    } else if (method_hash == CLOSE) {
-        try self.emit(receiver);
-        try self.emit(".close()");
-    } else {
-        return false;
+    const method = StreamMethods.get(method_name) orelse return false;
+    switch (method) {
+        .write => {
+            // stream.write(data) - returns bytes written (caller handles discard if needed)
+            try self.emit(receiver);
+            try self.emit(".write(");
+            if (args.len > 0) try parent.genExpr(self, args[0]);
+            try self.emit(")");
+        },
+        .read => {
+            try self.emit(receiver);
+            try self.emit(".read()");
+        },
+        .getvalue => {
+            try self.emit(receiver);
+            try self.emit(".getvalue()");
+        },
+        .seek => {
+            try self.emit(receiver);
+            try self.emit(".seek(");
+            if (args.len > 0) try parent.genExpr(self, args[0]) else try self.emit("0");
+            try self.emit(")");
+        },
+        .tell => {
+            try self.emit(receiver);
+            try self.emit(".tell()");
+        },
+        .truncate => {
+            try self.emit(receiver);
+            try self.emit(".truncate()");
+        },
+        .close => {
+            try self.emit(receiver);
+            try self.emit(".close()");
+        },
     }
     return true;
 }
@@ -623,38 +623,35 @@ fn handleHashMethod(self: *NativeCodegen, method_name: []const u8, obj: ast.Node
     defer self.allocator.free(receiver);
     self.output = saved_output;
 
-    const fnv = @import("fnv_hash");
-    const UPDATE = comptime fnv.hash("update");
-    const DIGEST = comptime fnv.hash("digest");
-    const HEXDIGEST = comptime fnv.hash("hexdigest");
-    const COPY = comptime fnv.hash("copy");
-
-    const method_hash = fnv.hash(method_name);
-    if (method_hash == UPDATE) {
-        // h.update(data) - modifies in place
-        try self.emit(receiver);
-        try self.emit(".update(");
-        if (args.len > 0) try parent.genExpr(self, args[0]);
-        try self.emit(")");
-    } else if (method_hash == DIGEST) {
-        // h.digest(allocator) - returns bytes
-        const alloc_name = if (self.symbol_table.currentScopeLevel() > 0) "__global_allocator" else "allocator";
-        try self.emit("try ");
-        try self.emit(receiver);
-        try self.emitFmt(".digest({s})", .{alloc_name});
-    } else if (method_hash == HEXDIGEST) {
-        // h.hexdigest(allocator) - returns hex string
-        // Use scope-aware allocator: __global_allocator in functions, allocator in main()
-        const alloc_name = if (self.symbol_table.currentScopeLevel() > 0) "__global_allocator" else "allocator";
-        try self.emit("try ");
-        try self.emit(receiver);
-        try self.emitFmt(".hexdigest({s})", .{alloc_name});
-    } else if (method_hash == COPY) {
-        // h.copy() - returns a copy
-        try self.emit(receiver);
-        try self.emit(".copy()");
-    } else {
-        return false;
+    const method = HashMethods.get(method_name) orelse return false;
+    switch (method) {
+        .update => {
+            // h.update(data) - modifies in place
+            try self.emit(receiver);
+            try self.emit(".update(");
+            if (args.len > 0) try parent.genExpr(self, args[0]);
+            try self.emit(")");
+        },
+        .digest => {
+            // h.digest(allocator) - returns bytes
+            const alloc_name = if (self.symbol_table.currentScopeLevel() > 0) "__global_allocator" else "allocator";
+            try self.emit("try ");
+            try self.emit(receiver);
+            try self.emitFmt(".digest({s})", .{alloc_name});
+        },
+        .hexdigest => {
+            // h.hexdigest(allocator) - returns hex string
+            // Use scope-aware allocator: __global_allocator in functions, allocator in main()
+            const alloc_name = if (self.symbol_table.currentScopeLevel() > 0) "__global_allocator" else "allocator";
+            try self.emit("try ");
+            try self.emit(receiver);
+            try self.emitFmt(".hexdigest({s})", .{alloc_name});
+        },
+        .copy => {
+            // h.copy() - returns a copy
+            try self.emit(receiver);
+            try self.emit(".copy()");
+        },
     }
     return true;
 }
@@ -6,6 +6,7 @@ const NativeCodegen = @import("../main.zig").NativeCodegen;
 const CodegenError = @import("../main.zig").CodegenError;
 const expressions = @import("../expressions.zig");
 const genExpr = expressions.genExpr;
+const numpy_codegen = @import("../numpy.zig");
 
 /// Check if an expression is a call to eval()
 fn isEvalCall(expr: ast.Node) bool {
@@ -312,6 +313,15 @@ pub fn genBinOp(self: *NativeCodegen, binop: ast.Node.BinOp) CodegenError!void {
         return;
     }
 
+    // Numpy elementwise arithmetic: fuse the whole chain (a*b + c) into one
+    // numpy.fused() call - a single SIMD loop with one output allocation
+    if (binop.op == .Add or binop.op == .Sub or binop.op == .Mult or binop.op == .Div) {
+        if (bigint_left_type == .numpy_array or bigint_right_type == .numpy_array) {
+            try numpy_codegen.genFusedElementwise(self, binop);
+            return;
+        }
+    }
+
     // Check if this is string concatenation
     if (binop.op == .Add) {
         // Use scope-aware type inference to prevent cross-function type pollution
@@ -154,6 +154,9 @@ pub fn deinit(self: *NativeCodegen) void {
     freeMapKeys(self.allocator, &self.comptime_evals);
     self.comptime_evals.deinit();
 
+    // Clean up comptime evaluator (keys are AST refs, not owned)
+    self.comptime_evaluator.deinit();
+
     // Clean up hoisted vars (not owned - AST references)
     self.hoisted_vars.deinit();
 
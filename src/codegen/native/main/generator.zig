@@ -108,6 +108,14 @@ pub fn generate(self: *NativeCodegen, module: ast.Node.Module) ![]const u8 {
         }
     }
 
+    // PHASE 2.2: Register pure module-level functions for comptime call folding
+    // (calls to them with constant arguments evaluate at compile time)
+    for (module.body) |stmt| {
+        if (stmt == .function_def) {
+            try self.comptime_evaluator.registerFunction(stmt.function_def);
+        }
+    }
+
     // PHASE 2.5: Analyze mutations for list ArrayList vs fixed array decision
     const mutation_analyzer = @import("../../../analysis/native_types/mutation_analyzer.zig");
     var mutations = try mutation_analyzer.analyzeMutations(module, self.allocator);
@@ -599,34 +607,31 @@ pub fn generate(self: *NativeCodegen, module: ast.Node.Module) ![]const u8 {
         }
         try self.emit("\";\n\n");
 
-        // Add lambda functions
-        for (self.lambda_functions.items) |lambda_code| {
-            try self.emit(lambda_code);
-        }
-
-        // Find where class/function definitions start (after imports, __name__, __file__)
-        // Parse current_output to extract everything after imports and magic constants
-        var lines = std.mem.splitScalar(u8, current_output, '\n');
-        var skip_count: usize = 0;
-        while (lines.next()) |line| {
-            skip_count += 1;
-            if (std.mem.indexOf(u8, line, "const __file__") != null) {
-                // Skip this line and the blank line after
-                _ = lines.next(); // blank line
-                skip_count += 1;
-                break;
+        // Find where class/function definitions start (after imports, __name__, __file__):
+        // skip everything through the `const __file__` line and the blank line after it
+        var tail: []const u8 = current_output;
+        if (std.mem.indexOf(u8, current_output, "const __file__")) |file_pos| {
+            if (std.mem.indexOfScalarPos(u8, current_output, file_pos, '\n')) |line_end| {
+                if (std.mem.indexOfScalarPos(u8, current_output, line_end + 1, '\n')) |blank_end| {
+                    tail = current_output[blank_end + 1 ..];
+                }
             }
         }
 
-        // Append the rest of the original output (class/func defs + main)
-        var lines2 = std.mem.splitScalar(u8, current_output, '\n');
-        var i: usize = 0;
-        while (lines2.next()) |line| : (i += 1) {
-            if (i >= skip_count) {
-                try self.emit(line);
-                try self.emit("\n");
-            }
+        // Stitch prelude + lambdas + original body together from borrowed chunks.
+        // For multi-MB modules this avoids the realloc/memmove churn of
+        // re-appending the whole body through the contiguous output buffer.
+        const code_builder = @import("../code_builder.zig");
+        var rope = code_builder.Rope.init();
+        defer rope.deinit(self.allocator);
+
+        try rope.append(self.allocator, self.output.items);
+        for (self.lambda_functions.items) |lambda_code| {
+            try rope.append(self.allocator, lambda_code);
         }
+        try rope.append(self.allocator, tail);
+
+        return rope.toOwnedSlice(self.allocator);
     }
 
     return self.output.toOwnedSlice(self.allocator);
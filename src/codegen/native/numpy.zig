@@ -1729,3 +1729,83 @@ pub fn genLstsq(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     try self.genExpr(args[1]);
     try self.emit(", allocator)");
 }
+
+// ============================================================================
+// Fused elementwise expressions
+// ============================================================================
+
+const NativeType = @import("../../analysis/native_types/core.zig").NativeType;
+
+/// Kernel argument limit for fused expressions; deeper chains nest another
+/// fused call as a leaf operand
+const MAX_FUSED_INPUTS = 8;
+
+fn isElementwiseOp(op: anytype) bool {
+    return op == .Add or op == .Sub or op == .Mult or op == .Div;
+}
+
+/// Generate a fused numpy elementwise expression (a*b + c and the like).
+/// Instead of one numpy call per operator - each allocating a temporary and
+/// sweeping memory - the whole chain is flattened into a single numpy.fused()
+/// call whose comptime kernel evaluates the expression per vector lane, so
+/// the runtime does one loop and one output allocation.
+pub fn genFusedElementwise(self: *NativeCodegen, binop: ast.Node.BinOp) CodegenError!void {
+    var leaves = std.ArrayList(ast.Node){};
+    defer leaves.deinit(self.allocator);
+    var body = std.ArrayList(u8){};
+    defer body.deinit(self.allocator);
+
+    try collectFused(self, ast.Node{ .binop = binop }, &leaves, &body);
+
+    try self.emit("try numpy.fused(struct { inline fn k(");
+    for (0..leaves.items.len) |i| {
+        if (i > 0) try self.emit(", ");
+        try self.emitFmt("v{d}: anytype", .{i});
+    }
+    try self.emit(") @TypeOf(v0) { return ");
+    try self.emit(body.items);
+    try self.emit("; } }.k, .{ ");
+    for (leaves.items, 0..) |leaf, i| {
+        if (i > 0) try self.emit(", ");
+        const leaf_type = try self.inferExprScoped(leaf);
+        if (leaf_type == .int or leaf_type == .usize) {
+            // Scalar operands reach the kernel as f64
+            try self.emit("@as(f64, @floatFromInt(");
+            try self.genExpr(leaf);
+            try self.emit("))");
+        } else {
+            try self.genExpr(leaf);
+        }
+    }
+    try self.emit(" }, allocator)");
+}
+
+/// Flatten an elementwise chain: interior nodes become kernel arithmetic,
+/// everything else (arrays, scalars, matmul results, ...) becomes a kernel
+/// input vN. Appends the kernel expression text to `body`.
+fn collectFused(self: *NativeCodegen, node: ast.Node, leaves: *std.ArrayList(ast.Node), body: *std.ArrayList(u8)) CodegenError!void {
+    if (node == .binop and isElementwiseOp(node.binop.op) and leaves.items.len + 2 <= MAX_FUSED_INPUTS) {
+        const left_type = try self.inferExprScoped(node.binop.left.*);
+        const right_type = try self.inferExprScoped(node.binop.right.*);
+        if (left_type == .numpy_array or right_type == .numpy_array) {
+            try body.append(self.allocator, '(');
+            try collectFused(self, node.binop.left.*, leaves, body);
+            const op_str: []const u8 = switch (node.binop.op) {
+                .Add => " + ",
+                .Sub => " - ",
+                .Mult => " * ",
+                .Div => " / ",
+                else => unreachable,
+            };
+            try body.appendSlice(self.allocator, op_str);
+            try collectFused(self, node.binop.right.*, leaves, body);
+            try body.append(self.allocator, ')');
+            return;
+        }
+    }
+
+    var label_buf: [16]u8 = undefined;
+    const label = std.fmt.bufPrint(&label_buf, "v{d}", .{leaves.items.len}) catch unreachable;
+    try body.appendSlice(self.allocator, label);
+    try leaves.append(self.allocator, node);
+}
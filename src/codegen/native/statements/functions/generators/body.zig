@@ -7,6 +7,7 @@ const CodeBuilder = @import("../../../code_builder.zig").CodeBuilder;
 const self_analyzer = @import("../self_analyzer.zig");
 const param_analyzer = @import("../param_analyzer.zig");
 const allocator_analyzer = @import("../allocator_analyzer.zig");
+const escape_analysis = @import("../../../../../analysis/escape_analysis.zig");
 const signature = @import("signature.zig");
 const hashmap_helper = @import("hashmap_helper");
 const zig_keywords = @import("zig_keywords");
@@ -845,6 +846,15 @@ fn isBuiltinName(name: []const u8) bool {
 }
 
 /// Generate function body with scope management
+/// Whether the program imports a module backed by the runtime profiler
+fn profilingImported(self: *NativeCodegen) bool {
+    return self.imported_modules.contains("_lsprof") or
+        self.imported_modules.contains("cProfile") or
+        self.imported_modules.contains("profile") or
+        self.imported_modules.contains("tracemalloc") or
+        self.imported_modules.contains("_tracemalloc");
+}
+
 pub fn genFunctionBody(
     self: *NativeCodegen,
     func: ast.Node.FunctionDef,
@@ -876,6 +886,46 @@ pub fn genFunctionBody(
     // Push new scope for function body
     try self.pushScope();
 
+    // Frame registry for the sampling profiler: when the program imports a
+    // profiling module, register this function on the runtime shadow stack
+    // so SIGPROF samples and allocation traces resolve to Python names.
+    // Not emitted otherwise, so unprofiled builds pay nothing.
+    if (profilingImported(self)) {
+        try self.emitIndent();
+        try self.emit("runtime.profiler.enterFrame(\"");
+        try self.emit(func.name);
+        try self.emit("\");\n");
+        try self.emitIndent();
+        try self.emit("defer runtime.profiler.leaveFrame();\n");
+    }
+
+    // Escape analysis: if no allocation can outlive this call, route
+    // __global_allocator through a function-scoped arena so temporaries
+    // (intermediate strings, loop-local lists) are bulk-freed at return.
+    // __global_allocator is a module-level var, so rebinding it here is
+    // legal Zig (no shadowing) and every allocation site in the body
+    // picks up the arena automatically. The defer restores the caller's
+    // allocator on all exit paths, including error returns. Individual
+    // frees inside the body become no-ops under the arena, which is safe.
+    if (allocator_analyzer.functionNeedsAllocator(func) and
+        escape_analysis.functionAllocationsStayLocal(func))
+    {
+        try self.emitIndent();
+        try self.emit("const __saved_allocator = __global_allocator;\n");
+        try self.emitIndent();
+        try self.emit("var __escape_arena = std.heap.ArenaAllocator.init(__saved_allocator);\n");
+        try self.emitIndent();
+        try self.emit("defer {\n");
+        try self.emitIndent();
+        try self.emit("    __global_allocator = __saved_allocator;\n");
+        try self.emitIndent();
+        try self.emit("    __escape_arena.deinit();\n");
+        try self.emitIndent();
+        try self.emit("}\n");
+        try self.emitIndent();
+        try self.emit("__global_allocator = __escape_arena.allocator();\n\n");
+    }
+
     // Note: Unused parameters are handled in signature.zig with "_" prefix
     // (e.g., unused param "op" becomes "_op" in signature)
     // No need to emit "_ = param;" here since "_" prefix already suppresses the warning
@@ -5,27 +5,28 @@ const CodegenError = @import("main.zig").CodegenError;
 const NativeCodegen = @import("main.zig").NativeCodegen;
 
 /// Generate tracemalloc.start(nframe=1)
+/// Interposes the runtime's counting allocator in front of __global_allocator
 pub fn genStart(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.tracemallocStart(&__global_allocator)");
 }
 
 /// Generate tracemalloc.stop()
 pub fn genStop(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.tracemallocStop(&__global_allocator)");
 }
 
 /// Generate tracemalloc.is_tracing()
 pub fn genIsTracing(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("false");
+    try self.emit("runtime.profiler.tracemallocIsTracing()");
 }
 
 /// Generate tracemalloc.clear_traces()
 pub fn genClearTraces(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.clearTraces()");
 }
 
 /// Generate tracemalloc.get_object_traceback(obj)
@@ -43,19 +44,19 @@ pub fn genGetTracebackLimit(self: *NativeCodegen, args: []ast.Node) CodegenError
 /// Generate tracemalloc.get_traced_memory()
 pub fn genGetTracedMemory(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit(".{ @as(i64, 0), @as(i64, 0) }");
+    try self.emit("runtime.profiler.getTracedMemory()");
 }
 
 /// Generate tracemalloc.reset_peak()
 pub fn genResetPeak(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("{}");
+    try self.emit("runtime.profiler.resetPeak()");
 }
 
 /// Generate tracemalloc.get_tracemalloc_memory()
 pub fn genGetTracemallocMemory(self: *NativeCodegen, args: []ast.Node) CodegenError!void {
     _ = args;
-    try self.emit("@as(i64, 0)");
+    try self.emit("runtime.profiler.getTracemallocMemory()");
 }
 
 /// Generate tracemalloc.take_snapshot()
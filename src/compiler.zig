@@ -1,5 +1,6 @@
 const std = @import("std");
 const compiler_utils = @import("compiler_utils.zig");
+const build_cache = @import("build_cache.zig");
 
 /// Get build directory (reuse .build for all processes)
 fn getBuildDir(allocator: std.mem.Allocator) ![]const u8 {
@@ -7,6 +8,32 @@ fn getBuildDir(allocator: std.mem.Allocator) ![]const u8 {
     return ".build";
 }
 
+/// Vendored libdeflate sources (same list as build.zig) - compiled into
+/// generated programs so the runtime gzip/zlib fast paths can link their
+/// whole-buffer codec
+const libdeflate_sources = [_][]const u8{
+    "vendor/libdeflate/lib/deflate_compress.c",
+    "vendor/libdeflate/lib/deflate_decompress.c",
+    "vendor/libdeflate/lib/utils.c",
+    "vendor/libdeflate/lib/gzip_compress.c",
+    "vendor/libdeflate/lib/gzip_decompress.c",
+    "vendor/libdeflate/lib/zlib_compress.c",
+    "vendor/libdeflate/lib/zlib_decompress.c",
+    "vendor/libdeflate/lib/adler32.c",
+    "vendor/libdeflate/lib/crc32.c",
+    "vendor/libdeflate/lib/arm/cpu_features.c",
+    "vendor/libdeflate/lib/x86/cpu_features.c",
+};
+
+/// True when the import set pulls in a compression module (zlib/gzip both
+/// register the "z" link library); those builds also need libdeflate
+fn needsLibdeflate(c_libraries: []const []const u8) bool {
+    for (c_libraries) |lib| {
+        if (std.mem.eql(u8, lib, "z")) return true;
+    }
+    return false;
+}
+
 /// Compile Zig source code to native binary
 pub fn compileZig(allocator: std.mem.Allocator, zig_code: []const u8, output_path: []const u8, c_libraries: []const []const u8) !void {
     // Use arena for all intermediate allocations
@@ -14,6 +41,13 @@ pub fn compileZig(allocator: std.mem.Allocator, zig_code: []const u8, output_pat
     defer arena.deinit();
     const aa = arena.allocator();
 
+    // Content-hash cache: identical generated source + libs skips zig entirely
+    const cache_key = build_cache.computeKey(zig_code, c_libraries, .exe);
+    if (build_cache.fetch(aa, &cache_key, output_path)) {
+        std.debug.print("✓ Build cache hit, skipping zig build-exe\n", .{});
+        return;
+    }
+
     const build_dir = try getBuildDir(aa);
 
     // Create build directory if it doesn't exist
@@ -159,6 +193,15 @@ pub fn compileZig(allocator: std.mem.Allocator, zig_code: []const u8, output_pat
         try args.append(aa, lib_flag);
     }
 
+    // Compression modules: compile vendored libdeflate for the whole-buffer
+    // gzip/zlib fast paths (header include path + C sources)
+    if (needsLibdeflate(c_libraries)) {
+        try args.append(aa, "-Ivendor/libdeflate");
+        for (libdeflate_sources) |src_file| {
+            try args.append(aa, src_file);
+        }
+    }
+
     // Add BLAS linking ONLY if explicitly needed (c_libraries non-empty)
     // This avoids unnecessary Accelerate framework loading (~1.2ms startup overhead)
     const builtin = @import("builtin");
@@ -196,10 +239,19 @@ pub fn compileZig(allocator: std.mem.Allocator, zig_code: []const u8, output_pat
         std.debug.print("Zig compilation failed:\n{s}\n", .{result.stderr});
         return error.ZigCompilationFailed;
     }
+
+    build_cache.store(aa, &cache_key, output_path);
 }
 
 /// Compile Zig source code to shared library (.so/.dylib)
 pub fn compileZigSharedLib(allocator: std.mem.Allocator, zig_code: []const u8, output_path: []const u8, c_libraries: []const []const u8) !void {
+    // Content-hash cache: identical generated source + libs skips zig entirely
+    const cache_key = build_cache.computeKey(zig_code, c_libraries, .shared_lib);
+    if (build_cache.fetch(allocator, &cache_key, output_path)) {
+        std.debug.print("✓ Build cache hit, skipping zig build-lib\n", .{});
+        return;
+    }
+
     const build_dir = try getBuildDir(allocator);
 
     // Create build directory if it doesn't exist
@@ -325,6 +377,15 @@ pub fn compileZigSharedLib(allocator: std.mem.Allocator, zig_code: []const u8, o
         try args.append(allocator, lib_flag);
     }
 
+    // Compression modules: compile vendored libdeflate for the whole-buffer
+    // gzip/zlib fast paths (header include path + C sources)
+    if (needsLibdeflate(c_libraries)) {
+        try args.append(allocator, "-Ivendor/libdeflate");
+        for (libdeflate_sources) |src_file| {
+            try args.append(allocator, src_file);
+        }
+    }
+
     // Add BLAS linking ONLY if explicitly needed (c_libraries non-empty)
     // This avoids unnecessary Accelerate framework loading (~1.2ms startup overhead)
     const builtin = @import("builtin");
@@ -366,6 +427,8 @@ pub fn compileZigSharedLib(allocator: std.mem.Allocator, zig_code: []const u8, o
         std.debug.print("Zig compilation failed:\n{s}\n", .{result.stderr});
         return error.ZigCompilationFailed;
     }
+
+    build_cache.store(allocator, &cache_key, output_path);
 }
 
 /// Compile Zig source code to WASM binary
@@ -375,6 +438,13 @@ pub fn compileWasm(allocator: std.mem.Allocator, zig_code: []const u8, output_pa
     defer arena.deinit();
     const aa = arena.allocator();
 
+    // Content-hash cache: identical generated source skips zig entirely
+    const cache_key = build_cache.computeKey(zig_code, &.{}, .wasm);
+    if (build_cache.fetch(aa, &cache_key, output_path)) {
+        std.debug.print("✓ Build cache hit, skipping zig build-exe (wasm)\n", .{});
+        return;
+    }
+
     const build_dir = try getBuildDir(aa);
 
     // Create build directory if it doesn't exist
@@ -492,6 +562,8 @@ pub fn compileWasm(allocator: std.mem.Allocator, zig_code: []const u8, output_pa
         std.debug.print("WASM compilation failed:\n{s}\n", .{result.stderr});
         return error.WasmCompilationFailed;
     }
+
+    build_cache.store(aa, &cache_key, output_path);
 }
 
 fn findZigBinary(allocator: std.mem.Allocator) ![]const u8 {
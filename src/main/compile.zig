@@ -27,6 +27,64 @@ fn getModuleOutputPath(allocator: std.mem.Allocator, module_path: []const u8) ![
     return output.getModuleOutputPath(allocator, module_path);
 }
 
+/// Below this many modules the thread-pool setup costs more than it saves
+const PARALLEL_MODULE_THRESHOLD = 2;
+
+/// One imported module queued for compilation
+const ModuleCompileJob = struct {
+    path: []const u8,
+    name: []const u8,
+};
+
+/// Thread-pool entry point: run the full lex→parse→analyze→codegen pipeline
+/// for one module. Failures are warnings (matches the serial path) so one bad
+/// module doesn't abort the whole build.
+fn compileModuleWorker(allocator: std.mem.Allocator, job: ModuleCompileJob) void {
+    std.debug.print("  Compiling module: {s} (as {s})\n", .{ job.path, job.name });
+    compileModule(allocator, job.path, job.name) catch |err| {
+        std.debug.print("  Warning: Failed to compile module {s}: {}\n", .{ job.path, err });
+    };
+}
+
+/// Compile all imported modules from the import graph, in parallel when there
+/// are enough of them. Modules discovered by the import scanner are independent
+/// (each emits its own .build/<name>.zig), so lexing, parsing and type analysis
+/// run on a thread pool; only the final binary emission for the main file stays
+/// serialized in compileFile.
+fn compileImportedModules(allocator: std.mem.Allocator, aa: std.mem.Allocator, import_graph: *import_scanner.ImportGraph, input_file: []const u8) !void {
+    // Collect jobs up front (skip the main file itself)
+    var jobs = std.ArrayList(ModuleCompileJob){};
+    var iter = import_graph.modules.iterator();
+    while (iter.next()) |entry| {
+        const module_path = entry.key_ptr.*;
+        if (std.mem.eql(u8, module_path, input_file)) continue;
+        try jobs.append(aa, .{ .path = module_path, .name = entry.value_ptr.module_name });
+    }
+
+    const cpu_count = std.Thread.getCpuCount() catch 1;
+    if (jobs.items.len < PARALLEL_MODULE_THRESHOLD or cpu_count <= 1) {
+        // Serial fallback: tiny graphs or single-core hosts
+        for (jobs.items) |job| {
+            compileModuleWorker(aa, job);
+        }
+        return;
+    }
+
+    // Workers allocate through their own arenas (inside compileModule), but the
+    // backing allocator must be thread-safe since arenas grow concurrently.
+    var tsa = std.heap.ThreadSafeAllocator{ .child_allocator = allocator };
+
+    var pool: std.Thread.Pool = undefined;
+    try pool.init(.{ .allocator = allocator, .n_jobs = @min(cpu_count, jobs.items.len) });
+    defer pool.deinit();
+
+    var wait_group: std.Thread.WaitGroup = .{};
+    for (jobs.items) |job| {
+        pool.spawnWg(&wait_group, compileModuleWorker, .{ tsa.allocator(), job });
+    }
+    pool.waitAndWork(&wait_group);
+}
+
 pub fn compileModule(allocator: std.mem.Allocator, module_path: []const u8, module_name: []const u8) !void {
     // Use arena allocator for all intermediate allocations to avoid leaks on parse errors
     var arena = std.heap.ArenaAllocator.init(allocator);
@@ -351,21 +409,7 @@ pub fn compileFile(allocator: std.mem.Allocator, opts: CompileOptions) !void {
         if (err != error.PathAlreadyExists) return err;
     };
     std.debug.print("Compiling {d} imported modules...\n", .{import_graph.modules.count()});
-    var iter = import_graph.modules.iterator();
-    while (iter.next()) |entry| {
-        const module_path = entry.key_ptr.*;
-        const module_info = entry.value_ptr.*;
-
-        // Skip the main file itself
-        if (std.mem.eql(u8, module_path, opts.input_file)) continue;
-
-        // Compile module using the proper module name
-        std.debug.print("  Compiling module: {s} (as {s})\n", .{ module_path, module_info.module_name });
-        compileModule(aa, module_path, module_info.module_name) catch |err| {
-            std.debug.print("  Warning: Failed to compile module {s}: {}\n", .{ module_path, err });
-            continue;
-        };
-    }
+    try compileImportedModules(allocator, aa, &import_graph, opts.input_file);
 
     // PHASE 2.5: C Library Import Detection
     var import_ctx = c_interop.ImportContext.init(aa);